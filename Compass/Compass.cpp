@@ -8,6 +8,30 @@
 #include "Compass.h"
 #include <Wire.h>
 
+#ifdef DRIVER_STATS
+#include <DriverProbe.h>
+#else
+#define DRIVER_PROBE_START()
+#define DRIVER_PROBE_END(probe, miss)
+#endif
+
+// Sees every transaction when the I2CTrace library is linked in.
+extern "C" void i2cTrace(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length, bool read) __attribute__((weak));
+
+// The multiplexer channels currently open, shared by every compass.
+uint8_t Compass::_selectedMux = COMPASS_NO_MUX;
+uint8_t Compass::_selectedChannels = 0;
+unsigned long Compass::_muxSwitches = 0;
+
+// Set by the DRDY pin interrupts, one slot per compass with a pin.
+volatile bool Compass::_dataReady[COMPASS_READY_SLOTS] = { false, false };
+uint8_t Compass::_readySlots = 0;
+
+// Output period in microseconds for each data output rate.
+static const uint32_t COMPASS_PERIODS[7] PROGMEM = {
+    1333333UL, 666667UL, 333333UL, 133333UL, 66667UL, 33333UL, 13333UL
+};
+
 /**
  * Constructor. Sensor field range is +/- 1.3 Ga by default. Use 
  * any of the setGainXXX methods to change this. 
@@ -18,6 +42,14 @@
 Compass::Compass() {
     this->res = GAIN_1_3_RES;
     this->val = GAIN_1_3_VAL;
+    this->_configA = COMPASS_AVG_1 | COMPASS_RATE_15 | COMPASS_BIAS_NONE;
+    this->_highRate = false;
+    this->_lastRead = 0;
+    this->_sawBusy = false;
+    this->_readySlot = -1;
+    this->_pending = false;
+    this->_muxAddress = COMPASS_NO_MUX;
+    this->_muxChannel = 0;
 }
 
 /**
@@ -39,6 +71,7 @@ void Compass::begin() {
  * 
  */
 void Compass::setModeContinuous() {
+    this->_highRate = false;
     this->i2cWrite(COMPASS_MODE, COMPASS_MODE_C);
 }
 
@@ -53,6 +86,195 @@ void Compass::setModeSingle() {
     this->i2cWrite(COMPASS_MODE, COMPASS_MODE_S);
 }
 
+/**
+ * Sample faster than the 75Hz continuous mode allows by 
+ * back to back single measurements, about 160Hz. Averaging is 
+ * turned off to keep each measurement short. Use readIfDue() 
+ * to pick up samples. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void Compass::setModeHighRate() {
+    this->setAveraging(COMPASS_AVG_1);
+    this->_highRate = true;
+    this->trigger();
+}
+
+/**
+ * Set the data output rate used in continuous mode.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param rate One of the COMPASS_RATE_ values, 0.75Hz to 75Hz.
+ */
+void Compass::setDataRate(uint8_t rate) {
+    this->_configA = (this->_configA & ~COMPASS_RATE_MASK) | (rate & COMPASS_RATE_MASK);
+    this->i2cWrite(COMPASS_CONFIG_A, this->_configA);
+}
+
+/**
+ * Set the number of samples the compass averages into each 
+ * output. Averaging on the chip costs no bus traffic or CPU. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param average One of COMPASS_AVG_1, _2, _4 or _8.
+ */
+void Compass::setAveraging(uint8_t average) {
+    this->_configA = (this->_configA & ~COMPASS_AVG_MASK) | (average & COMPASS_AVG_MASK);
+    this->i2cWrite(COMPASS_CONFIG_A, this->_configA);
+}
+
+/**
+ * Set the measurement bias. The positive and negative bias 
+ * modes apply a known field for self test and calibration. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param bias COMPASS_BIAS_NONE, COMPASS_BIAS_POS or 
+ *             COMPASS_BIAS_NEG.
+ */
+void Compass::setBias(uint8_t bias) {
+    this->_configA = (this->_configA & ~COMPASS_BIAS_MASK) | (bias & COMPASS_BIAS_MASK);
+    this->i2cWrite(COMPASS_CONFIG_A, this->_configA);
+}
+
+/**
+ * Gets the time between new samples at the current settings.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The sample period in microseconds.
+ */
+unsigned long Compass::samplePeriod() {
+    if (this->_highRate) {
+        return this->measureTime();
+    }
+    uint8_t rate = (this->_configA & COMPASS_RATE_MASK) >> 2;
+    if (rate > 6) {
+        rate = 6;
+    }
+    return pgm_read_dword(&COMPASS_PERIODS[rate]);
+}
+
+/**
+ * Gets the time a single measurement takes at the current 
+ * averaging, one measurement per averaged sample. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The measurement time in microseconds.
+ */
+unsigned long Compass::measureTime() {
+    return (unsigned long)COMPASS_MEASURE_US << ((this->_configA & COMPASS_AVG_MASK) >> 5);
+}
+
+/**
+ * Use the DRDY pin to learn when a new sample is in the output 
+ * registers. DRDY pulses low for 250us per sample, too short to 
+ * poll, so the pin interrupt latches it. Without a pin, 
+ * readIfDue() and ready() check the RDY bit in STATUS instead. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param pin The Arduino pin DRDY is wired to. It must support 
+ *            attachInterrupt().
+ * @return false if the pin has no interrupt or 
+ *         COMPASS_READY_SLOTS compasses already have a pin.
+ */
+bool Compass::setReadyPin(int pin) {
+    int interrupt = digitalPinToInterrupt(pin);
+    if (interrupt == NOT_AN_INTERRUPT) {
+        return false;
+    }
+    if (this->_readySlot < 0) {
+        if (Compass::_readySlots >= COMPASS_READY_SLOTS) {
+            return false;
+        }
+        this->_readySlot = Compass::_readySlots++;
+    }
+
+    this->_dataReady[this->_readySlot] = false;
+    pinMode(pin, INPUT_PULLUP);
+    if (this->_readySlot == 0) {
+        attachInterrupt(interrupt, Compass::readyFirst, FALLING);
+    } else {
+        attachInterrupt(interrupt, Compass::readySecond, FALLING);
+    }
+    return true;
+}
+
+void Compass::readyFirst() {
+    Compass::_dataReady[0] = true;
+}
+
+void Compass::readySecond() {
+    Compass::_dataReady[1] = true;
+}
+
+/**
+ * Read the compass only if a new sample has arrived, so loop() 
+ * can call this freely without missing samples as long as it is 
+ * called at least once per period. Use with continuous or high 
+ * rate mode. 
+ *  
+ * With a DRDY pin this never touches the bus until a sample 
+ * arrives. Otherwise STATUS is polled from shortly before the 
+ * sample is due. RDY stays set until the chip starts writing the 
+ * next sample, so a new sample shows as RDY dropping and coming 
+ * back; if the drop is missed the sample is read once it is 
+ * overdue. This follows the chip's own clock rather than 
+ * drifting against micros(). 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return true if a new sample was read.
+ */
+bool Compass::readIfDue() {
+    if (this->_highRate) {
+        return this->collect(true);
+    }
+
+    if (this->_readySlot >= 0) {
+        if (!this->_dataReady[this->_readySlot]) {
+            return false;
+        }
+        this->_dataReady[this->_readySlot] = false;
+        this->read();
+        return true;
+    }
+
+    unsigned long now = micros();
+    unsigned long period = this->samplePeriod();
+    unsigned long margin = period / COMPASS_DUE_MARGIN;
+    unsigned long elapsed = now - this->_lastRead;
+    if (elapsed < period - margin) {
+        return false;
+    }
+
+    if (!(this->i2cRead(COMPASS_STATUS, 1)[0] & COMPASS_STATUS_RDY)) {
+        this->_sawBusy = true;
+        return false;
+    }
+
+    if (this->_sawBusy) {
+        // Just arrived, so it marks the chip's sample time.
+        this->_lastRead = now;
+    } else if (elapsed < period + margin) {
+        return false;
+    } else {
+        // Overdue; stay on the last known grid unless a period behind.
+        this->_lastRead += period;
+        if (now - this->_lastRead >= period) {
+            this->_lastRead = now;
+        }
+    }
+    this->_sawBusy = false;
+    this->read();
+    return true;
+}
+
 /**
  * Put the compass in sleep mode. This can be used to to save 
  * power when the compass is not needed. 
@@ -61,6 +283,7 @@ void Compass::setModeSingle() {
  * 
  */
 void Compass::setModeSleep() {
+    this->_highRate = false;
     this->i2cWrite(COMPASS_MODE, COMPASS_MODE_I);
 }
 
@@ -169,6 +392,7 @@ void Compass::setGain8_1() {
  * 
  */
 void Compass::read() {
+    DRIVER_PROBE_START();
     uint8_t* buffer = this->i2cRead(COMPASS_OUT_X_H, 6);
     this->rawX = buffer[0] << 8 | buffer[1];
     this->rawZ = buffer[2] << 8 | buffer[3];
@@ -176,6 +400,77 @@ void Compass::read() {
     this->scaledX = this->rawX * this->res;
     this->scaledY = this->rawY * this->res;
     this->scaledZ = this->rawZ * this->res;
+    DRIVER_PROBE_END(DRIVER_COMPASS_READ, false);
+}
+
+/**
+ * Start a single measurement and return straight away. Use 
+ * collect() to pick up the result once it is ready, doing other 
+ * work in the meantime. The compass idles again after the 
+ * measurement. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void Compass::trigger() {
+    if (this->_readySlot >= 0) {
+        this->_dataReady[this->_readySlot] = false;
+    }
+    this->setModeSingle();
+    this->_triggered = micros();
+    this->_pending = true;
+}
+
+/**
+ * Checks if a triggered measurement has completed. RDY in 
+ * STATUS still shows the previous sample until the new one is 
+ * written, so the bus is only checked once the measurement time 
+ * has passed, or the DRDY pin is used if one was set. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return true once the triggered measurement is in the output 
+ *         registers.
+ */
+bool Compass::ready() {
+    if (!this->_pending) {
+        return false;
+    }
+    if (this->_readySlot >= 0) {
+        return this->_dataReady[this->_readySlot];
+    }
+    if (micros() - this->_triggered < this->measureTime()) {
+        return false;
+    }
+    return this->i2cRead(COMPASS_STATUS, 1)[0] & COMPASS_STATUS_RDY;
+}
+
+/**
+ * Read the result of a triggered measurement if it is ready. 
+ * Never waits for the measurement. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param rearm Trigger the next measurement straight after 
+ *              reading, so it converts while the caller works.
+ * @return true if a result was read into the raw and scaled 
+ *         members, false if nothing was triggered or it is not
+ *         ready yet.
+ */
+bool Compass::collect(bool rearm) {
+    if (!this->ready()) {
+        return false;
+    }
+
+    this->_pending = false;
+    if (this->_readySlot >= 0) {
+        this->_dataReady[this->_readySlot] = false;
+    }
+    this->read();
+    if (rearm) {
+        this->trigger();
+    }
+    return true;
 }
 
 /**
@@ -200,6 +495,59 @@ float Compass::heading() {
     return heading;
 }
 
+/**
+ * Put this compass behind a channel of a TCA9548A style I2C 
+ * multiplexer. Every compass answers at COMPASS_ADDR, so more 
+ * than one can only share a bus on separate channels. The 
+ * channel is switched before each transaction, and only when a 
+ * different compass was used last. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param muxAddress The multiplexer address, 0x70 - 0x77, or 
+ *                   COMPASS_NO_MUX for a compass on the main
+ *                   bus.
+ * @param channel The multiplexer channel, 0 - 7.
+ */
+void Compass::setMux(uint8_t muxAddress, uint8_t channel) {
+    this->_muxAddress = muxAddress;
+    this->_muxChannel = channel & 0x07;
+}
+
+/**
+ * Gets the multiplexer this compass is behind.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The multiplexer address or COMPASS_NO_MUX.
+ */
+uint8_t Compass::muxAddress() {
+    return this->_muxAddress;
+}
+
+/**
+ * Gets the multiplexer channel this compass is on.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The channel, 0 - 7.
+ */
+uint8_t Compass::muxChannel() {
+    return this->_muxChannel;
+}
+
+/**
+ * Gets the number of multiplexer writes made so far by all 
+ * compasses. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The switch count.
+ */
+unsigned long Compass::muxSwitches() {
+    return Compass::_muxSwitches;
+}
+
 /**
  * Write a value to a register on the device being managed. 
  * Refer to the datasheet for valid values and registers. All 
@@ -211,10 +559,15 @@ float Compass::heading() {
  * 
  */
 void Compass::i2cWrite(byte reg, byte value) {
+    this->select();
     Wire.beginTransmission(COMPASS_ADDR);
     Wire.write(reg);
     Wire.write(value);
     Wire.endTransmission();
+
+    if (i2cTrace) {
+        i2cTrace(COMPASS_ADDR, reg, &value, 1, false);
+    }
 }
 
 /**
@@ -224,13 +577,20 @@ void Compass::i2cWrite(byte reg, byte value) {
  * @author nedwidek (2013/03/14) 
  * @param reg The register to read from (or the register to 
  *            start at.
- * @param length The number of bytes to read. 
- * @return A buffer containing the requested values. 
+ * @param length The number of bytes to read, at most 
+ *               COMPASS_BUFFER.
+ * @return A buffer containing the requested values. It is 
+ *         reused by the next read.
  * 
  */
 uint8_t* Compass::i2cRead(byte reg, int length) {
-    uint8_t buffer[length];
+    uint8_t* buffer = this->_buffer;
 
+    if (length > COMPASS_BUFFER) {
+        length = COMPASS_BUFFER;
+    }
+
+    this->select();
     Wire.beginTransmission(COMPASS_ADDR);
     Wire.write(reg);
     Wire.endTransmission();
@@ -243,9 +603,52 @@ uint8_t* Compass::i2cRead(byte reg, int length) {
     }
     Wire.endTransmission();
 
+    if (i2cTrace) {
+        i2cTrace(COMPASS_ADDR, reg, buffer, length, true);
+    }
+
     return buffer;
 }
 
 void Compass::setGain() {
     i2cWrite(COMPASS_CONFIG_B, this->val);
 }
+
+// Open the multiplexer channel for this compass if it is not open
+// already. Each channel write is its own transaction ended with a stop,
+// since a TCA9548A only switches its channels on the stop. Writes are
+// traced with the control byte as both register and data.
+void Compass::select() {
+    uint8_t channels = this->_muxAddress == COMPASS_NO_MUX ? 0 : 1 << this->_muxChannel;
+
+    if (Compass::_selectedMux == this->_muxAddress && Compass::_selectedChannels == channels) {
+        return;
+    }
+
+    // Close any other multiplexer, or its compass would answer too.
+    if (Compass::_selectedMux != COMPASS_NO_MUX && Compass::_selectedMux != this->_muxAddress) {
+        uint8_t closed = 0x00;
+        Wire.beginTransmission(Compass::_selectedMux);
+        Wire.write(closed);
+        Wire.endTransmission();
+        Compass::_muxSwitches++;
+
+        if (i2cTrace) {
+            i2cTrace(Compass::_selectedMux, closed, &closed, 1, false);
+        }
+    }
+
+    if (this->_muxAddress != COMPASS_NO_MUX) {
+        Wire.beginTransmission(this->_muxAddress);
+        Wire.write(channels);
+        Wire.endTransmission();
+        Compass::_muxSwitches++;
+
+        if (i2cTrace) {
+            i2cTrace(this->_muxAddress, channels, &channels, 1, false);
+        }
+    }
+
+    Compass::_selectedMux = this->_muxAddress;
+    Compass::_selectedChannels = channels;
+}
@@ -31,6 +31,50 @@
 #define COMPASS_MODE_S   (0x01)
 #define COMPASS_MODE_I   (0x03)
 
+// Data output rates in continuous mode (CONFIG_A bits 4:2)
+#define COMPASS_RATE_0_75  (0x00)
+#define COMPASS_RATE_1_5   (0x04)
+#define COMPASS_RATE_3     (0x08)
+#define COMPASS_RATE_7_5   (0x0C)
+#define COMPASS_RATE_15    (0x10)
+#define COMPASS_RATE_30    (0x14)
+#define COMPASS_RATE_75    (0x18)
+#define COMPASS_RATE_MASK  (0x1C)
+
+// Samples averaged per output (CONFIG_A bits 6:5)
+#define COMPASS_AVG_1      (0x00)
+#define COMPASS_AVG_2      (0x20)
+#define COMPASS_AVG_4      (0x40)
+#define COMPASS_AVG_8      (0x60)
+#define COMPASS_AVG_MASK   (0x60)
+
+// Measurement bias (CONFIG_A bits 1:0)
+#define COMPASS_BIAS_NONE  (0x00)
+#define COMPASS_BIAS_POS   (0x01)
+#define COMPASS_BIAS_NEG   (0x02)
+#define COMPASS_BIAS_MASK  (0x03)
+
+// Status register bits
+#define COMPASS_STATUS_RDY  (0x01)
+#define COMPASS_STATUS_LOCK (0x02)
+
+// Time for a single measurement of one sample (typical 6ms per
+// datasheet). Each averaged sample adds another (see measureTime()).
+#define COMPASS_MEASURE_US (6000)
+
+// readIfDue() polls STATUS from 1/8 of a period before a sample is due
+// and reads anyway 1/8 of a period after, if it never saw RDY drop.
+#define COMPASS_DUE_MARGIN (8)
+
+// Compasses that can have a DRDY pin interrupt (see setReadyPin()).
+#define COMPASS_READY_SLOTS (2)
+
+// No I2C multiplexer in front of the compass (see setMux()).
+#define COMPASS_NO_MUX   (0xFF)
+
+// Size of the read buffer, enough for every register.
+#define COMPASS_BUFFER   (13)
+
 // Gain values
 #define GAIN__88_VAL     (0x00)
 #define GAIN__88_RES     (0.73)
@@ -56,6 +100,14 @@ public:
     void setModeContinuous();
     void setModeSingle();
     void setModeSleep();
+    void setModeHighRate();
+    void setDataRate(uint8_t rate);
+    void setAveraging(uint8_t average);
+    void setBias(uint8_t bias);
+    unsigned long samplePeriod();
+    unsigned long measureTime();
+    bool setReadyPin(int pin);
+    bool readIfDue();
     void setGain_88();
     void setGain1_3();
     void setGain1_9();
@@ -65,7 +117,14 @@ public:
     void setGain5_6();
     void setGain8_1();
     void read();
+    void trigger();
+    bool ready();
+    bool collect(bool rearm = false);
     float heading();
+    void setMux(uint8_t muxAddress, uint8_t channel);
+    uint8_t muxAddress();
+    uint8_t muxChannel();
+    static unsigned long muxSwitches();
     void i2cWrite(byte reg, byte value);
     uint8_t* i2cRead(byte reg, int length);
     int rawX, rawY, rawZ;
@@ -73,7 +132,25 @@ public:
 private:
     float res;
     uint8_t val;
+    uint8_t _configA;
+    bool _highRate;
+    unsigned long _lastRead;
+    bool _sawBusy;
+    int8_t _readySlot;
+    bool _pending;
+    unsigned long _triggered;
+    uint8_t _buffer[COMPASS_BUFFER];
+    uint8_t _muxAddress;
+    uint8_t _muxChannel;
+    static uint8_t _selectedMux;
+    static uint8_t _selectedChannels;
+    static unsigned long _muxSwitches;
+    static volatile bool _dataReady[COMPASS_READY_SLOTS];
+    static uint8_t _readySlots;
+    static void readyFirst();
+    static void readySecond();
     void setGain();
+    void select();
 };
 
 #endif
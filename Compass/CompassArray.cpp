@@ -0,0 +1,119 @@
+// Samples many compasses behind I2C multiplexers at the full rate
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include "CompassArray.h"
+
+/**
+ * Constructor. Set each compass's multiplexer channel with 
+ * Compass::setMux() and add() it. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+CompassArray::CompassArray() {
+    this->_count = 0;
+    this->_updated = 0;
+}
+
+/**
+ * Add a compass to the array. Compasses are kept in multiplexer 
+ * and channel order, so a round visits each multiplexer once 
+ * and steps through its channels in turn. Indexes change as 
+ * compasses are added. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param compass The compass, already given its channel.
+ * @return false if the array is full.
+ */
+bool CompassArray::add(Compass& compass) {
+    if (this->_count >= COMPASS_ARRAY_MAX) {
+        return false;
+    }
+
+    uint16_t key = compass.muxAddress() << 8 | compass.muxChannel();
+    uint8_t i = this->_count;
+    while (i > 0 && (this->_units[i - 1]->muxAddress() << 8 | this->_units[i - 1]->muxChannel()) > key) {
+        this->_units[i] = this->_units[i - 1];
+        i--;
+    }
+    this->_units[i] = &compass;
+    this->_count++;
+    return true;
+}
+
+/**
+ * Gets the number of compasses in the array.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The compass count.
+ */
+uint8_t CompassArray::size() {
+    return this->_count;
+}
+
+/**
+ * Gets a compass by its place in the array.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param index 0 to size() - 1.
+ * @return The compass, or 0 for an index out of range.
+ */
+Compass* CompassArray::unit(uint8_t index) {
+    return index < this->_count ? this->_units[index] : 0;
+}
+
+/**
+ * Start a single measurement on every compass. Call once after 
+ * Wire is started, then poll() from loop(). 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void CompassArray::begin() {
+    for (uint8_t i=0; i < this->_count; i++) {
+        this->_units[i]->trigger();
+    }
+}
+
+/**
+ * Read every compass whose measurement is complete and start its 
+ * next one. The read and the next trigger go out together after 
+ * a single channel switch, so each compass costs one switch per 
+ * sample. Every compass runs at the single measurement rate 
+ * (about 160Hz) as long as a round of reads fits in the 
+ * measurement time; use a 400kHz bus for more than a few. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The number of compasses read.
+ */
+uint8_t CompassArray::poll() {
+    uint8_t read = 0;
+
+    this->_updated = 0;
+    for (uint8_t i=0; i < this->_count; i++) {
+        if (this->_units[i]->collect(true)) {
+            this->_updated |= (uint32_t) 1 << i;
+            read++;
+        }
+    }
+    return read;
+}
+
+/**
+ * Checks if a compass was read by the last poll().
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param index 0 to size() - 1.
+ * @return true if its raw and scaled members are new.
+ */
+bool CompassArray::updated(uint8_t index) {
+    return index < this->_count && (this->_updated & ((uint32_t) 1 << index)) != 0;
+}
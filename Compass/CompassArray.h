@@ -0,0 +1,33 @@
+// Samples many compasses behind I2C multiplexers at the full rate
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef CompassArray_h
+#define CompassArray_h
+
+#include "Arduino.h"
+#include "Compass.h"
+
+// Most compasses in one array (at most 32).
+#ifndef COMPASS_ARRAY_MAX
+#define COMPASS_ARRAY_MAX (16)
+#endif
+
+// See .cpp source for method documentation.
+class CompassArray {
+public:
+    CompassArray();
+    bool add(Compass& compass);
+    uint8_t size();
+    Compass* unit(uint8_t index);
+    void begin();
+    uint8_t poll();
+    bool updated(uint8_t index);
+private:
+    Compass* _units[COMPASS_ARRAY_MAX];
+    uint8_t _count;
+    uint32_t _updated;
+};
+
+#endif
@@ -0,0 +1,79 @@
+// Compile time configured Parallax 3-Axis Compass (29133-RT)
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef StaticCompass_h
+#define StaticCompass_h
+
+#include "Arduino.h"
+#include <Wire.h>
+#include "Compass.h"
+
+// Compass with the gain and CONFIG_A settings fixed at compile time. All
+// methods are static and samples go straight into the caller's variables,
+// so it takes no RAM of its own. It does not switch a multiplexer; use
+// Compass for that:
+//   typedef StaticCompass<GAIN_1_3_VAL, COMPASS_AVG_8 | COMPASS_RATE_15> Heading;
+//   Heading::begin();
+//   Heading::setModeContinuous();
+//   Heading::read(x, y, z);
+template <uint8_t GAIN = GAIN_1_3_VAL, uint8_t CONFIG_A = COMPASS_AVG_1 | COMPASS_RATE_15 | COMPASS_BIAS_NONE>
+class StaticCompass {
+public:
+    static void begin() {
+        Wire.begin();
+        i2cWrite(COMPASS_CONFIG_A, CONFIG_A);
+        i2cWrite(COMPASS_CONFIG_B, GAIN);
+    }
+    static void setModeContinuous() {
+        i2cWrite(COMPASS_MODE, COMPASS_MODE_C);
+    }
+    static void setModeSingle() {
+        i2cWrite(COMPASS_MODE, COMPASS_MODE_S);
+    }
+    static void setModeSleep() {
+        i2cWrite(COMPASS_MODE, COMPASS_MODE_I);
+    }
+    static bool ready() {
+        Wire.beginTransmission(COMPASS_ADDR);
+        Wire.write(COMPASS_STATUS);
+        Wire.endTransmission();
+        Wire.requestFrom((uint8_t) COMPASS_ADDR, (uint8_t) 1);
+        while (Wire.available() < 1);
+        return Wire.read() & COMPASS_STATUS_RDY;
+    }
+    static void read(int& x, int& y, int& z) {
+        Wire.beginTransmission(COMPASS_ADDR);
+        Wire.write(COMPASS_OUT_X_H);
+        Wire.endTransmission();
+        Wire.requestFrom((uint8_t) COMPASS_ADDR, (uint8_t) 6);
+        while (Wire.available() < 6);
+
+        // The chip orders the axes X, Z, Y.
+        x = Wire.read() << 8;
+        x |= Wire.read();
+        z = Wire.read() << 8;
+        z |= Wire.read();
+        y = Wire.read() << 8;
+        y |= Wire.read();
+    }
+    static float heading() {
+        int x, y, z;
+        read(x, y, z);
+
+        float heading = atan2(y, x);
+        if (heading < 0) {
+            heading += 2*PI;
+        }
+        return heading * 180/M_PI;
+    }
+    static void i2cWrite(byte reg, byte value) {
+        Wire.beginTransmission(COMPASS_ADDR);
+        Wire.write(reg);
+        Wire.write(value);
+        Wire.endTransmission();
+    }
+};
+
+#endif
@@ -0,0 +1,30 @@
+// Timing probes placed in the drivers when DRIVER_STATS is defined
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// A driver .cpp includes this only when built with DRIVER_STATS, and
+// otherwise defines both probe macros as nothing, so a build without
+// DRIVER_STATS carries no instrumentation at all and does not need this
+// library.
+
+#ifndef DriverProbe_h
+#define DriverProbe_h
+
+#include "Arduino.h"
+
+// Instrumented driver calls.
+#define DRIVER_COMPASS_READ     (0)
+#define DRIVER_GYROSCOPE_READ   (1)
+#define DRIVER_PING             (2)
+#define DRIVER_TMP36_MV         (3)
+#define DRIVER_LCD_WRITE        (4)
+#define DRIVER_STRIP_SEND       (5)
+#define DRIVER_PROBES           (6)
+
+void driverStatsRecord(uint8_t probe, unsigned long elapsed, bool miss);
+
+#define DRIVER_PROBE_START() unsigned long driverProbeStart = micros()
+#define DRIVER_PROBE_END(probe, miss) driverStatsRecord((probe), micros() - driverProbeStart, (miss))
+
+#endif
@@ -0,0 +1,185 @@
+// Latency histograms and counters for the drivers in this repository
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// Build the drivers with DRIVER_STATS defined (for example with
+// -DDRIVER_STATS in the compiler flags) and include DriverStats.h in the
+// sketch. Each probe times one driver call with micros() and records it
+// here in constant time.
+
+#include "Arduino.h"
+#include "DriverStats.h"
+
+struct Probe {
+    unsigned long calls;
+    unsigned long misses;
+    unsigned long max;
+    uint16_t buckets[DRIVER_STATS_BUCKETS];
+};
+
+static Probe probes[DRIVER_PROBES];
+
+static const char NAMES[DRIVER_PROBES][4] PROGMEM = {
+    "cmp", "gyr", "png", "tmp", "lcd", "rgb"
+};
+
+void driverStatsRecord(uint8_t probe, unsigned long elapsed, bool miss) {
+    Probe& p = probes[probe];
+
+    uint8_t bucket = 0;
+    for (unsigned long rest = elapsed; rest != 0 && bucket < DRIVER_STATS_BUCKETS - 1; rest >>= 1) {
+        bucket++;
+    }
+
+    // Counts stick at their limit rather than wrap.
+    if (p.buckets[bucket] != 0xFFFF) {
+        p.buckets[bucket]++;
+    }
+    p.calls++;
+    if (miss) {
+        p.misses++;
+    }
+    if (elapsed > p.max) {
+        p.max = elapsed;
+    }
+}
+
+/**
+ * Constructor. The figures are shared by every DriverStats, so 
+ * one object is enough. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+DriverStats::DriverStats() {
+}
+
+/**
+ * Clear every counter and histogram.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void DriverStats::reset() {
+    memset(probes, 0, sizeof(probes));
+}
+
+/**
+ * Gets the number of calls timed by a probe.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param probe One of the DRIVER_ probe numbers.
+ * @return The call count.
+ */
+unsigned long DriverStats::calls(uint8_t probe) {
+    return probe < DRIVER_PROBES ? probes[probe].calls : 0;
+}
+
+/**
+ * Gets the number of calls that failed to get a result: pings 
+ * with no echo and strip updates on an invalid pin. A queued 
+ * LCD write waits for room instead of dropping the byte, so LCD 
+ * writes never miss. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param probe One of the DRIVER_ probe numbers.
+ * @return The miss count.
+ */
+unsigned long DriverStats::misses(uint8_t probe) {
+    return probe < DRIVER_PROBES ? probes[probe].misses : 0;
+}
+
+/**
+ * Gets the longest call timed by a probe.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param probe One of the DRIVER_ probe numbers.
+ * @return The time in microseconds.
+ */
+unsigned long DriverStats::maxMicros(uint8_t probe) {
+    return probe < DRIVER_PROBES ? probes[probe].max : 0;
+}
+
+/**
+ * Gets one histogram bucket of a probe.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param probe One of the DRIVER_ probe numbers.
+ * @param bucket 0 to DRIVER_STATS_BUCKETS - 1.
+ * @return The number of calls in the bucket, at most 65535.
+ */
+uint16_t DriverStats::bucket(uint8_t probe, uint8_t bucket) {
+    if (probe >= DRIVER_PROBES || bucket >= DRIVER_STATS_BUCKETS) {
+        return 0;
+    }
+    return probes[probe].buckets[bucket];
+}
+
+/**
+ * Print one line per probe that has been called: 
+ *    cmp 1200 0 812 0,0,0,0,0,0,0,0,0,1199,1 
+ * giving the name, calls, misses, longest call in 
+ * microseconds and the histogram up to its last non-empty 
+ * bucket. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param out Where to print, e.g. Serial.
+ */
+void DriverStats::dump(Print& out) {
+    for (uint8_t i=0; i < DRIVER_PROBES; i++) {
+        Probe& p = probes[i];
+        if (p.calls == 0) {
+            continue;
+        }
+
+        for (uint8_t c=0; c < 3; c++) {
+            out.write(pgm_read_byte(&NAMES[i][c]));
+        }
+        out.print(' ');
+        out.print(p.calls);
+        out.print(' ');
+        out.print(p.misses);
+        out.print(' ');
+        out.print(p.max);
+        out.print(' ');
+
+        uint8_t last = DRIVER_STATS_BUCKETS - 1;
+        while (last > 0 && p.buckets[last] == 0) {
+            last--;
+        }
+        for (uint8_t b=0; b <= last; b++) {
+            if (b > 0) {
+                out.print(',');
+            }
+            out.print(p.buckets[b]);
+        }
+        out.println();
+    }
+}
+
+/**
+ * Answer single character commands: '?' dumps the figures and 
+ * '!' resets them. Other characters are ignored. Call from 
+ * loop(). 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param io Where commands come from and the dump goes, e.g. 
+ *           Serial.
+ */
+void DriverStats::poll(Stream& io) {
+    while (io.available() > 0) {
+        int command = io.read();
+        if (command == '?') {
+            this->dump(io);
+        } else if (command == '!') {
+            this->reset();
+        }
+    }
+}
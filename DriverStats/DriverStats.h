@@ -0,0 +1,30 @@
+// Latency histograms and counters for the drivers in this repository
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef DriverStats_h
+#define DriverStats_h
+
+#include "Arduino.h"
+#include "DriverProbe.h"
+
+// Histogram buckets. Bucket n counts calls taking 2^(n-1) to 2^n - 1
+// microseconds; bucket 0 is under 1us and the last takes everything
+// longer.
+#define DRIVER_STATS_BUCKETS    (16)
+
+// See .cpp source for method documentation.
+class DriverStats {
+public:
+    DriverStats();
+    void reset();
+    unsigned long calls(uint8_t probe);
+    unsigned long misses(uint8_t probe);
+    unsigned long maxMicros(uint8_t probe);
+    uint16_t bucket(uint8_t probe, uint8_t bucket);
+    void dump(Print& out);
+    void poll(Stream& io);
+};
+
+#endif
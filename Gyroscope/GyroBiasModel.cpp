@@ -0,0 +1,144 @@
+// Temperature compensated bias model for the L3G4200D gyroscope
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include "GyroBiasModel.h"
+
+/**
+ * Constructor. Starts with nothing learned, so no correction 
+ * is applied. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+GyroBiasModel::GyroBiasModel() {
+    this->reset();
+}
+
+/**
+ * Forget everything learned.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void GyroBiasModel::reset() {
+    this->_based = false;
+    memset(this->_count, 0, sizeof(this->_count));
+}
+
+/**
+ * Add the last read() to the bias table. Only call this while 
+ * the gyroscope is known to be still, since everything it 
+ * measures is taken as bias. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param gyro A gyroscope that has just been read.
+ */
+void GyroBiasModel::learn(const Gyroscope& gyro) {
+    if (!this->_based) {
+        this->_base = gyro.temperature - GYRO_BIAS_BINS * GYRO_BIAS_WIDTH / 2;
+        this->_based = true;
+    }
+
+    uint8_t b = this->bin(gyro.temperature);
+    int raw[3] = { gyro.x, gyro.y, gyro.z };
+    uint8_t n = this->_count[b];
+    int weight = n < GYRO_BIAS_SETTLE ? n + 1 : GYRO_BIAS_SETTLE;
+
+    // Biases are kept in 1/16 counts, as long since a full scale reading
+    // does not fit an int once scaled. Averages over the first samples
+    // of a bin, then follows slow drift.
+    for (uint8_t i=0; i < 3; i++) {
+        long sample = (long) raw[i] << 4;
+        if (n == 0) {
+            this->_bias[b][i] = sample;
+        } else {
+            this->_bias[b][i] += (sample - this->_bias[b][i]) / weight;
+        }
+    }
+    if (n < 255) {
+        this->_count[b] = n + 1;
+    }
+}
+
+/**
+ * Subtract the bias for the current die temperature from the 
+ * last read(). 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param gyro A gyroscope that has just been read.
+ */
+void GyroBiasModel::compensate(Gyroscope& gyro) {
+    int correction[3];
+    this->bias(gyro.temperature, correction);
+    gyro.x -= correction[0];
+    gyro.y -= correction[1];
+    gyro.z -= correction[2];
+}
+
+/**
+ * Gets the modelled bias at a temperature, interpolated between 
+ * the neighbouring learned bins. Outside the learned range the 
+ * nearest learned bin is used. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param temperature The die temperature as read by the 
+ *                    gyroscope.
+ * @param out Receives the X, Y and Z bias in raw counts, zero if 
+ *            nothing has been learned.
+ */
+void GyroBiasModel::bias(int8_t temperature, int out[3]) {
+    out[0] = out[1] = out[2] = 0;
+    if (!this->_based) {
+        return;
+    }
+
+    // Position between bin centres in 1/16 bins.
+    int pos = ((temperature - this->_base) * 16 - GYRO_BIAS_WIDTH * 8) / GYRO_BIAS_WIDTH;
+    if (pos < 0) {
+        pos = 0;
+    } else if (pos > (GYRO_BIAS_BINS - 1) * 16) {
+        pos = (GYRO_BIAS_BINS - 1) * 16;
+    }
+    uint8_t lo = pos >> 4;
+    uint8_t hi = lo < GYRO_BIAS_BINS - 1 ? lo + 1 : lo;
+    uint8_t fraction = pos & 0x0F;
+
+    if (this->_count[lo] == 0 || this->_count[hi] == 0) {
+        // Fall back to the nearest bin that has been learned.
+        int8_t nearest = -1;
+        for (uint8_t d=0; d < GYRO_BIAS_BINS && nearest < 0; d++) {
+            if (lo + d < GYRO_BIAS_BINS && this->_count[lo + d] != 0) {
+                nearest = lo + d;
+            } else if (lo >= d && this->_count[lo - d] != 0) {
+                nearest = lo - d;
+            }
+        }
+        if (nearest < 0) {
+            return;
+        }
+        lo = hi = nearest;
+        fraction = 0;
+    }
+
+    for (uint8_t i=0; i < 3; i++) {
+        long b = this->_bias[lo][i] + ((this->_bias[hi][i] - this->_bias[lo][i]) * fraction >> 4);
+        out[i] = (b + 8) >> 4;
+    }
+}
+
+uint8_t GyroBiasModel::bin(int8_t temperature) {
+    int b = (temperature - this->_base) / GYRO_BIAS_WIDTH;
+    if (b < 0) {
+        return 0;
+    }
+    if (b >= GYRO_BIAS_BINS) {
+        return GYRO_BIAS_BINS - 1;
+    }
+    return b;
+}
@@ -0,0 +1,36 @@
+// Temperature compensated bias model for the L3G4200D gyroscope
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef GyroBiasModel_h
+#define GyroBiasModel_h
+
+#include "Arduino.h"
+#include "Gyroscope.h"
+
+// The table covers GYRO_BIAS_BINS * GYRO_BIAS_WIDTH degrees, centred on
+// the temperature of the first sample learned.
+#define GYRO_BIAS_BINS      (8)
+#define GYRO_BIAS_WIDTH     (4)
+// Once a bin has this many samples it becomes a running average with
+// this weight for new samples.
+#define GYRO_BIAS_SETTLE    (16)
+
+// See .cpp source for method documentation.
+class GyroBiasModel {
+public:
+    GyroBiasModel();
+    void reset();
+    void learn(const Gyroscope& gyro);
+    void compensate(Gyroscope& gyro);
+    void bias(int8_t temperature, int out[3]);
+private:
+    bool _based;
+    int8_t _base;
+    long _bias[GYRO_BIAS_BINS][3];
+    uint8_t _count[GYRO_BIAS_BINS];
+    uint8_t bin(int8_t temperature);
+};
+
+#endif
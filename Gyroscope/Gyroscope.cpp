@@ -7,6 +7,18 @@
 #include "Gyroscope.h"
 #include <Wire.h>
 
+#ifdef DRIVER_STATS
+#include <DriverProbe.h>
+#else
+#define DRIVER_PROBE_START()
+#define DRIVER_PROBE_END(probe, miss)
+#endif
+
+// Sees every transaction when the I2CTrace library is linked in.
+extern "C" void i2cTrace(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length, bool read) __attribute__((weak));
+
+volatile bool Gyroscope::_motion[2] = { false, false };
+
 /**
  * Constructor. Assumes that this is the primary Gyroscope and 
  * that SDO is connected to ground. 
@@ -16,6 +28,7 @@
  */
 Gyroscope::Gyroscope() {
     this->_GYRO_ADDR = GYRO_ADDR0;
+    this->init();
 }
 
 /**
@@ -31,6 +44,7 @@ Gyroscope::Gyroscope() {
  */
 Gyroscope::Gyroscope(bool isSecondary) {
     this->setIsSecondary(isSecondary);
+    this->init();
 }
 
 /**
@@ -97,22 +111,236 @@ void Gyroscope::setMode(bool isPowered, bool isXOn, bool isYOn, bool isZOn) {
         value |= 0x01;
     }
 
-    this->i2cWrite(GYRO_CTRL_REG1, value);
+    this->_ctrl1 = (this->_ctrl1 & 0xF0) | value;
+    this->i2cWrite(GYRO_CTRL_REG1, this->_ctrl1);
+}
+
+/**
+ * Set the output data rate and bandwidth. Power and axis 
+ * settings from setMode() are kept. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param rate GYRO_ODR_100, _200, _400 or _800 (Hz).
+ * @param bandwidth GYRO_BW_0 to GYRO_BW_3. Refer to the 
+ *                  datasheet for the cut off at each rate.
+ */
+void Gyroscope::setRate(GyroRate rate, GyroBandwidth bandwidth) {
+    this->_ctrl1 = (this->_ctrl1 & 0x0F) | rate | bandwidth;
+    this->i2cWrite(GYRO_CTRL_REG1, this->_ctrl1);
+}
+
+/**
+ * Set the full scale. This also sets the scale used by the 
+ * xMdps(), yMdps() and zMdps() outputs. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param scale GYRO_FS_250, GYRO_FS_500 or GYRO_FS_2000 (dps).
+ */
+void Gyroscope::setScale(GyroScale scale) {
+    this->_ctrl4 = (this->_ctrl4 & ~0x30) | scale;
+    switch (scale) {
+    case GYRO_FS_250:
+        this->_quarterMdps = GyroSensitivity<GYRO_FS_250>::quarterMdps;
+        break;
+    case GYRO_FS_500:
+        this->_quarterMdps = GyroSensitivity<GYRO_FS_500>::quarterMdps;
+        break;
+    default:
+        this->_quarterMdps = GyroSensitivity<GYRO_FS_2000>::quarterMdps;
+        break;
+    }
+    this->i2cWrite(GYRO_CTRL_REG4, this->_ctrl4);
+}
+
+/**
+ * Turn block data update on or off. When on, the output 
+ * registers are not updated until both bytes of the previous 
+ * sample have been read, so a read never mixes two samples. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param enabled true to enable block data update.
+ */
+void Gyroscope::setBlockDataUpdate(bool enabled) {
+    if (enabled) {
+        this->_ctrl4 |= 0x80;
+    } else {
+        this->_ctrl4 &= ~0x80;
+    }
+    this->i2cWrite(GYRO_CTRL_REG4, this->_ctrl4);
 }
 
 /**
  * Measure the rotation information and place the output in the 
- * x, y, and z members of this class. 
+ * x, y, and z members of this class. The die temperature sits 
+ * just ahead of the outputs, so it is read in the same burst 
+ * into the temperature member. 
  *  
  * @author nedwidek (2013/03/14)
  * 
  */
 void Gyroscope::read() {
-    byte* buffer = this->i2cRead(GYRO_OUT_X_L | 0x80, 6);
+    DRIVER_PROBE_START();
+    byte* buffer = this->i2cRead(GYRO_OUT_TEMP | 0x80, 8);
     
-    this->x = buffer[1] << 8 | buffer[0];
-    this->y = buffer[3] << 8 | buffer[2];
-    this->z = buffer[5] << 8 | buffer[4];
+    this->temperature = (int8_t) buffer[0];
+    this->x = buffer[3] << 8 | buffer[2];
+    this->y = buffer[5] << 8 | buffer[4];
+    this->z = buffer[7] << 8 | buffer[6];
+    DRIVER_PROBE_END(DRIVER_GYROSCOPE_READ, false);
+}
+
+/**
+ * Program the INT1 generator to raise the INT1 pin when the 
+ * rate on any axis goes above its threshold for long enough, 
+ * and watch for it with a pin interrupt. The host can then 
+ * leave the bus idle until motionPending() says there was 
+ * motion. Thresholds should be above the zero rate level. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param pin The Arduino pin INT1 is wired to. It must support 
+ *            attachInterrupt().
+ * @param thresholdX X threshold in raw counts, 0 - 32767, or 0 
+ *                   to ignore the X axis.
+ * @param thresholdY Y threshold in raw counts, or 0 to ignore.
+ * @param thresholdZ Z threshold in raw counts, or 0 to ignore.
+ * @param duration Samples (1/ODR) the rate must stay above the 
+ *                 threshold, 0 - 127.
+ * @return false if the pin has no interrupt.
+ */
+bool Gyroscope::enableMotionInterrupt(int pin, int thresholdX, int thresholdY, int thresholdZ, uint8_t duration) {
+    int interrupt = digitalPinToInterrupt(pin);
+    if (interrupt == NOT_AN_INTERRUPT) {
+        return false;
+    }
+
+    // Latched OR of the enabled axes' high events.
+    byte cfg = 0x40;
+    if (thresholdX > 0) {
+        cfg |= GYRO_MOTION_X;
+    }
+    if (thresholdY > 0) {
+        cfg |= GYRO_MOTION_Y;
+    }
+    if (thresholdZ > 0) {
+        cfg |= GYRO_MOTION_Z;
+    }
+
+    this->i2cWrite(GYRO_INT1_TSH_XH, (thresholdX >> 8) & 0x7F);
+    this->i2cWrite(GYRO_INT1_TSH_XL, thresholdX & 0xFF);
+    this->i2cWrite(GYRO_INT1_TSH_YH, (thresholdY >> 8) & 0x7F);
+    this->i2cWrite(GYRO_INT1_TSH_YL, thresholdY & 0xFF);
+    this->i2cWrite(GYRO_INT1_TSH_ZH, (thresholdZ >> 8) & 0x7F);
+    this->i2cWrite(GYRO_INT1_TSH_ZL, thresholdZ & 0xFF);
+    this->i2cWrite(GYRO_INT1_DURATION, duration > 0 ? 0x80 | (duration & 0x7F) : 0x00);
+    this->i2cWrite(GYRO_INT1_CFG, cfg);
+
+    // Clear anything already latched before we start listening.
+    this->i2cRead(GYRO_INT1_SRC, 1);
+    this->_motion[this->_GYRO_ADDR - GYRO_ADDR0] = false;
+    this->_motionPin = pin;
+
+    pinMode(pin, INPUT);
+    if (this->_GYRO_ADDR == GYRO_ADDR0) {
+        attachInterrupt(interrupt, Gyroscope::motionPrimary, RISING);
+    } else {
+        attachInterrupt(interrupt, Gyroscope::motionSecondary, RISING);
+    }
+
+    // Route the generator to the INT1 pin, active high.
+    this->i2cWrite(GYRO_CTRL_REG3, 0x80);
+    return true;
+}
+
+/**
+ * Stop the INT1 generator and release the pin interrupt.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void Gyroscope::disableMotionInterrupt() {
+    this->i2cWrite(GYRO_CTRL_REG3, 0x00);
+    this->i2cWrite(GYRO_INT1_CFG, 0x00);
+    if (this->_motionPin >= 0) {
+        detachInterrupt(digitalPinToInterrupt(this->_motionPin));
+        this->_motionPin = -1;
+    }
+}
+
+/**
+ * Checks if the INT1 pin has signalled motion. This does not 
+ * touch the bus, so it is cheap to call from loop(). 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return true if motion was signalled since the last 
+ *         motionSource().
+ */
+bool Gyroscope::motionPending() {
+    return this->_motion[this->_GYRO_ADDR - GYRO_ADDR0];
+}
+
+/**
+ * Read what caused the motion interrupt. Reading INT1_SRC also 
+ * releases the latched interrupt so the next motion can be 
+ * signalled. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return GYRO_MOTION_X, _Y and/or _Z for the axes that went 
+ *         over their threshold, with GYRO_MOTION_ACTIVE set if
+ *         the interrupt was active.
+ */
+uint8_t Gyroscope::motionSource() {
+    this->_motion[this->_GYRO_ADDR - GYRO_ADDR0] = false;
+    return this->i2cRead(GYRO_INT1_SRC, 1)[0] & (GYRO_MOTION_ACTIVE | GYRO_MOTION_X | GYRO_MOTION_Y | GYRO_MOTION_Z);
+}
+
+void Gyroscope::motionPrimary() {
+    Gyroscope::_motion[0] = true;
+}
+
+void Gyroscope::motionSecondary() {
+    Gyroscope::_motion[1] = true;
+}
+
+/**
+ * Gets the X rate from the last read() in millidegrees per 
+ * second, using integer math at the current full scale. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The X rate in mdps.
+ */
+long Gyroscope::xMdps() {
+    return (long) this->x * this->_quarterMdps / 4;
+}
+
+/**
+ * Gets the Y rate from the last read() in millidegrees per 
+ * second. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The Y rate in mdps.
+ */
+long Gyroscope::yMdps() {
+    return (long) this->y * this->_quarterMdps / 4;
+}
+
+/**
+ * Gets the Z rate from the last read() in millidegrees per 
+ * second. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The Z rate in mdps.
+ */
+long Gyroscope::zMdps() {
+    return (long) this->z * this->_quarterMdps / 4;
 }
 
 /**
@@ -130,6 +358,10 @@ void Gyroscope::i2cWrite(byte reg, byte value) {
     Wire.write(reg);
     Wire.write(value);
     Wire.endTransmission();
+
+    if (i2cTrace) {
+        i2cTrace(this->_GYRO_ADDR, reg, &value, 1, false);
+    }
 }
 
 /**
@@ -145,12 +377,18 @@ void Gyroscope::i2cWrite(byte reg, byte value) {
  * @author nedwidek (2013/03/14) 
  * @param reg The register to read from (or the register to 
  *            start at.
- * @param length The number of bytes to read. 
- * @return A buffer containing the requested values. 
+ * @param length The number of bytes to read, at most 
+ *               GYRO_BUFFER.
+ * @return A buffer containing the requested values. It is 
+ *         reused by the next read.
  * 
  */
 uint8_t* Gyroscope::i2cRead(byte reg, int length) {
-    uint8_t buffer[length];
+    uint8_t* buffer = this->_buffer;
+
+    if (length > GYRO_BUFFER) {
+        length = GYRO_BUFFER;
+    }
 
     Wire.beginTransmission(this->_GYRO_ADDR);
     Wire.write(reg);
@@ -159,12 +397,15 @@ uint8_t* Gyroscope::i2cRead(byte reg, int length) {
 
     while (Wire.available() < length);
 
-    Serial.println("---------------------");
     for (uint8_t i=0; i < length; i++) {
         buffer[i] = Wire.read();
     }
     Wire.endTransmission();
 
+    if (i2cTrace) {
+        i2cTrace(this->_GYRO_ADDR, reg, buffer, length, true);
+    }
+
     return buffer;
 }
 
@@ -188,3 +429,11 @@ void Gyroscope::setIsSecondary(bool isSecondary) {
         this->_GYRO_ADDR = GYRO_ADDR0;
     }
 }
+
+// Register defaults after power up: 100Hz, lowest bandwidth, 250dps.
+void Gyroscope::init() {
+    this->_ctrl1 = GYRO_ODR_100 | GYRO_BW_0;
+    this->_ctrl4 = GYRO_FS_250;
+    this->_quarterMdps = GyroSensitivity<GYRO_FS_250>::quarterMdps;
+    this->_motionPin = -1;
+}
@@ -32,14 +32,57 @@
 #define GYRO_FIFO_SRC_REG   (0x2F)
 #define GYRO_INT1_CFG       (0x30)
 #define GYRO_INT1_SRC       (0x31)
-#define GYRO_INT1_TSH_XL    (0x32)
-#define GYRO_INT1_TSH_XH    (0x33)
-#define GYRO_INT1_TSH_YL    (0x34)
-#define GYRO_INT1_TSH_YH    (0x35)
-#define GYRO_INT1_TSH_ZL    (0x36)
-#define GYRO_INT1_TSH_ZH    (0x37)
+#define GYRO_INT1_TSH_XH    (0x32)
+#define GYRO_INT1_TSH_XL    (0x33)
+#define GYRO_INT1_TSH_YH    (0x34)
+#define GYRO_INT1_TSH_YL    (0x35)
+#define GYRO_INT1_TSH_ZH    (0x36)
+#define GYRO_INT1_TSH_ZL    (0x37)
 #define GYRO_INT1_DURATION  (0x38)
 
+// Motion causes reported by motionSource() (INT1_SRC bits).
+#define GYRO_MOTION_X       (0x02)
+#define GYRO_MOTION_Y       (0x08)
+#define GYRO_MOTION_Z       (0x20)
+#define GYRO_MOTION_ACTIVE  (0x40)
+
+// Size of the read buffer.
+#define GYRO_BUFFER         (8)
+
+// Output data rate (CTRL_REG1 bits 7:6).
+enum GyroRate {
+    GYRO_ODR_100  = 0x00,
+    GYRO_ODR_200  = 0x40,
+    GYRO_ODR_400  = 0x80,
+    GYRO_ODR_800  = 0xC0
+};
+
+// Bandwidth selection (CTRL_REG1 bits 5:4). The cut off for each depends
+// on the output data rate, see the datasheet.
+enum GyroBandwidth {
+    GYRO_BW_0     = 0x00,
+    GYRO_BW_1     = 0x10,
+    GYRO_BW_2     = 0x20,
+    GYRO_BW_3     = 0x30
+};
+
+// Full scale in degrees per second (CTRL_REG4 bits 5:4).
+enum GyroScale {
+    GYRO_FS_250   = 0x00,
+    GYRO_FS_500   = 0x10,
+    GYRO_FS_2000  = 0x20
+};
+
+// Sensitivity for a full scale in quarter millidegrees per second per
+// digit (8.75, 17.5 and 70 mdps/digit). Usable at compile time:
+//   long mdps = GyroSensitivity<GYRO_FS_500>::toMdps(gyro.x);
+template <GyroScale S> struct GyroSensitivity {
+    static const int quarterMdps = S == GYRO_FS_250 ? 35 : S == GYRO_FS_500 ? 70 : 280;
+    static long toMdps(int raw) {
+        return (long) raw * quarterMdps / 4;
+    }
+};
+
 
 // See .cpp source for method documentation.
 class Gyroscope {
@@ -50,15 +93,36 @@ public:
     void setModeDefault();
     void setModeSleep();
     void setMode(bool isPowered, bool isXOn, bool isYOn, bool isZOn);
+    void setRate(GyroRate rate, GyroBandwidth bandwidth);
+    void setScale(GyroScale scale);
+    void setBlockDataUpdate(bool enabled);
+    bool enableMotionInterrupt(int pin, int thresholdX, int thresholdY, int thresholdZ, uint8_t duration);
+    void disableMotionInterrupt();
+    bool motionPending();
+    uint8_t motionSource();
     void read(); 
+    long xMdps();
+    long yMdps();
+    long zMdps();
     void i2cWrite(byte reg, byte value);
     uint8_t* i2cRead(byte reg, int length);
     void setIsSecondary(bool isSecondary);
     int x;
     int y;
     int z;
+    // Die temperature, -1 per degree C from an uncalibrated offset.
+    int8_t temperature;
 private:
     uint8_t _GYRO_ADDR;
+    uint8_t _ctrl1;
+    uint8_t _ctrl4;
+    int _quarterMdps;
+    uint8_t _buffer[GYRO_BUFFER];
+    int _motionPin;
+    static volatile bool _motion[2];
+    static void motionPrimary();
+    static void motionSecondary();
+    void init();
 };
 
 #endif
@@ -0,0 +1,52 @@
+// Compile time configured Parallax 3-Axis Gyroscope (27911-RT)
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef StaticGyroscope_h
+#define StaticGyroscope_h
+
+#include "Arduino.h"
+#include <Wire.h>
+#include "Gyroscope.h"
+
+// Gyroscope with the bus address fixed at compile time. All methods are
+// static and samples go straight into the caller's variables, so it takes
+// no RAM of its own:
+//   typedef StaticGyroscope<GYRO_ADDR0> Gyro;
+//   Gyro::read(x, y, z);
+template <uint8_t ADDR = GYRO_ADDR0>
+class StaticGyroscope {
+public:
+    static void begin() {
+        Wire.begin();
+    }
+    static void setModeDefault() {
+        i2cWrite(GYRO_CTRL_REG1, 0x0F);
+    }
+    static void setModeSleep() {
+        i2cWrite(GYRO_CTRL_REG1, 0x00);
+    }
+    static void read(int& x, int& y, int& z) {
+        Wire.beginTransmission(ADDR);
+        Wire.write(GYRO_OUT_X_L | 0x80);
+        Wire.endTransmission();
+        Wire.requestFrom((uint8_t) ADDR, (uint8_t) 6);
+        while (Wire.available() < 6);
+
+        x = Wire.read();
+        x |= Wire.read() << 8;
+        y = Wire.read();
+        y |= Wire.read() << 8;
+        z = Wire.read();
+        z |= Wire.read() << 8;
+    }
+    static void i2cWrite(byte reg, byte value) {
+        Wire.beginTransmission(ADDR);
+        Wire.write(reg);
+        Wire.write(value);
+        Wire.endTransmission();
+    }
+};
+
+#endif
@@ -0,0 +1,116 @@
+// Records every Compass and Gyroscope I2C transaction to a compact trace
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// The drivers call a weak i2cTrace() hook after each transaction. Linking
+// this library supplies the hook; without it the call compiles away to a
+// null check.
+
+#include "Arduino.h"
+#include "I2CTrace.h"
+
+static I2CTrace* active = 0;
+
+extern "C" void i2cTrace(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length, bool read) {
+    if (active != 0) {
+        active->record(address, reg, data, length, read);
+    }
+}
+
+/**
+ * Constructor. Nothing is recorded until begin() is called.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+I2CTrace::I2CTrace() {
+    this->_out = 0;
+    this->_records = 0;
+}
+
+/**
+ * Start recording. Only one trace records at a time; starting 
+ * this one stops any other. 
+ *  
+ * The trace is written as the transactions happen, so out 
+ * needs to keep up: about 11 bytes per 6 byte sensor read. Use 
+ * a fast serial rate or an SD card file. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param out Where to write the trace, e.g. Serial.
+ */
+void I2CTrace::begin(Print& out) {
+    this->_out = &out;
+    this->_last = micros();
+    this->_records = 0;
+    active = this;
+}
+
+/**
+ * Stop recording.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void I2CTrace::end() {
+    if (active == this) {
+        active = 0;
+    }
+    this->_out = 0;
+}
+
+/**
+ * Checks if this trace is recording.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return true between begin() and end().
+ */
+bool I2CTrace::recording() {
+    return active == this;
+}
+
+/**
+ * Gets the number of transactions recorded since begin().
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The record count.
+ */
+unsigned long I2CTrace::records() {
+    return this->_records;
+}
+
+/**
+ * Append one transaction to the trace. Called by the drivers 
+ * through the i2cTrace() hook. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param address The 7 bit device address.
+ * @param reg The register written or read from.
+ * @param data The byte written or the bytes read.
+ * @param length The number of data bytes.
+ * @param read true for a read.
+ */
+void I2CTrace::record(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length, bool read) {
+    if (this->_out == 0) {
+        return;
+    }
+
+    uint8_t header[I2C_TRACE_MAX_HEADER];
+    unsigned long now = micros();
+    uint8_t size = 0;
+
+    header[size++] = (address & I2C_TRACE_ADDRESS) | (read ? I2C_TRACE_READ : 0);
+    size += i2cTracePutVarint(header + size, now - this->_last);
+    header[size++] = reg;
+    header[size++] = length;
+
+    this->_out->write(header, size);
+    this->_out->write(data, length);
+    this->_last = now;
+    this->_records++;
+}
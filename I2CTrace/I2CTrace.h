@@ -0,0 +1,27 @@
+// Records every Compass and Gyroscope I2C transaction to a compact trace
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef I2CTrace_h
+#define I2CTrace_h
+
+#include "Arduino.h"
+#include "I2CTraceFormat.h"
+
+// See .cpp source for method documentation.
+class I2CTrace {
+public:
+    I2CTrace();
+    void begin(Print& out);
+    void end();
+    bool recording();
+    unsigned long records();
+    void record(uint8_t address, uint8_t reg, const uint8_t* data, uint8_t length, bool read);
+private:
+    Print* _out;
+    unsigned long _last;
+    unsigned long _records;
+};
+
+#endif
@@ -0,0 +1,43 @@
+// I2C transaction trace format shared by the recorder and host replay
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// A trace is a plain series of records, one per driver transaction:
+//
+//   flags     bit 7 set for a read, bits 6-0 the 7 bit device address
+//   time      varint microseconds since the previous record (or since
+//             the recorder was started for the first record)
+//   register  the register written or read from
+//   length    number of data bytes
+//   data      the byte written, or the bytes read back
+//
+// A device with no registers, such as an I2C multiplexer, is written with
+// its control byte as both the register and the data.
+//
+// This header has no Arduino dependency so the host replay can share it.
+
+#ifndef I2CTraceFormat_h
+#define I2CTraceFormat_h
+
+#include <stdint.h>
+
+#define I2C_TRACE_READ      (0x80)
+#define I2C_TRACE_ADDRESS   (0x7F)
+
+// Largest header: flags, 5 byte time, register and length.
+#define I2C_TRACE_MAX_HEADER (8)
+
+// Write value as a base 128 varint, least significant group first.
+// Returns the number of bytes used (at most 5).
+inline uint8_t i2cTracePutVarint(uint8_t* out, uint32_t value) {
+    uint8_t length = 0;
+    while (value >= 0x80) {
+        out[length++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    out[length++] = value;
+    return length;
+}
+
+#endif
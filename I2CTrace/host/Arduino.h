@@ -0,0 +1,51 @@
+// Host stand-in for the Arduino core, enough to build the I2C drivers
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// Put this directory first on the include path so Compass.cpp and
+// Gyroscope.cpp pick up this header and Wire.h instead of the real core.
+// Time comes from the replay's virtual clock. RS2760249/host builds the
+// strip driver against it too.
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define pgm_read_byte(p)    (*(const uint8_t*) (p))
+#define pgm_read_word(p)    (*(const uint16_t*) (p))
+#define pgm_read_dword(p)   (*(const uint32_t*) (p))
+
+#define LOW                 (0)
+#define HIGH                (1)
+#define INPUT               (0)
+#define OUTPUT              (1)
+#define INPUT_PULLUP        (2)
+#define FALLING             (2)
+#define RISING              (3)
+#define PI                  (3.1415926535897932384626433832795)
+#define NOT_AN_INTERRUPT    (-1)
+#define digitalPinToInterrupt(p) ((p) == 2 ? 0 : ((p) == 3 ? 1 : NOT_AN_INTERRUPT))
+
+unsigned long micros();
+unsigned long millis();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+inline void pinMode(uint8_t pin, uint8_t mode) {}
+inline void digitalWrite(uint8_t pin, uint8_t value) {}
+inline int digitalRead(uint8_t pin) { return LOW; }
+inline void attachInterrupt(uint8_t interrupt, void (*isr)(void), int mode) {}
+inline void detachInterrupt(uint8_t interrupt) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+#endif
@@ -0,0 +1,386 @@
+// Feeds the Compass and Gyroscope drivers from a recorded I2C trace
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// Build the unmodified driver sources on a PC with this directory first
+// on the include path, together with I2CReplay.cpp. The drivers then talk
+// to the Wire object below, which answers reads with the bytes captured
+// by I2CTrace on the device.
+//
+// Time is virtual. micros() only moves when the drivers consume a
+// recorded transaction, when sync() is called, or through delay(), so a
+// capture replays as fast as the host can run the filter code and gives
+// the same results every run.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Arduino.h"
+#include "Wire.h"
+#include "I2CReplay.h"
+#include "../I2CTraceFormat.h"
+
+static I2CReplay* current = 0;
+static unsigned long virtualMicros = 0;
+
+TwoWire Wire;
+
+unsigned long micros() {
+    return virtualMicros;
+}
+
+unsigned long millis() {
+    return virtualMicros / 1000;
+}
+
+void delay(unsigned long ms) {
+    virtualMicros += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+    virtualMicros += us;
+}
+
+/**
+ * Constructor. Call open() to load a trace.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+I2CReplay::I2CReplay() {
+    this->_trace = 0;
+    this->_size = 0;
+    this->rewind();
+}
+
+I2CReplay::~I2CReplay() {
+    if (current == this) {
+        current = 0;
+    }
+    free(this->_trace);
+}
+
+/**
+ * Load a trace file written by I2CTrace and make it the one the 
+ * Wire object answers from. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param path The trace file.
+ * @return false if the file could not be read.
+ */
+bool I2CReplay::open(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == 0) {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    free(this->_trace);
+    this->_trace = (uint8_t*) malloc(size > 0 ? size : 1);
+    this->_size = this->_trace != 0 ? fread(this->_trace, 1, size, file) : 0;
+    fclose(file);
+
+    this->rewind();
+    current = this;
+    return this->_size == size;
+}
+
+/**
+ * Start again from the first transaction. The virtual clock 
+ * keeps running so drivers never see time go backwards. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void I2CReplay::rewind() {
+    this->_pos = 0;
+    this->_time = virtualMicros;
+    this->_transactions = 0;
+    this->_mismatches = 0;
+    this->_skipped = 0;
+}
+
+/**
+ * Checks if every recorded transaction has been used.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return true at the end of the trace.
+ */
+bool I2CReplay::done() {
+    Record record;
+    return !this->parse(this->_pos, this->_time, record);
+}
+
+/**
+ * Gets when the next recorded transaction happened.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The virtual micros() of the next transaction, or the
+ *         current time at the end of the trace.
+ */
+unsigned long I2CReplay::next() {
+    Record record;
+    if (!this->parse(this->_pos, this->_time, record)) {
+        return virtualMicros;
+    }
+    return record.time;
+}
+
+/**
+ * Move the virtual clock on to the next recorded transaction, 
+ * as though the sketch had waited for it. Call once per loop 
+ * when replaying code that polls micros() for its timing. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void I2CReplay::sync() {
+    unsigned long time = this->next();
+    if ((long) (time - virtualMicros) > 0) {
+        virtualMicros = time;
+    }
+}
+
+/**
+ * Gets the number of recorded transactions matched so far.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The transaction count.
+ */
+unsigned long I2CReplay::transactions() {
+    return this->_transactions;
+}
+
+/**
+ * Gets the number of driver transactions that did not match the 
+ * trace: writes of a different value or to a different 
+ * register, and reads with no recording left to answer them. 
+ * Non zero means the driver changed how it talks to the part. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The mismatch count.
+ */
+unsigned long I2CReplay::mismatches() {
+    return this->_mismatches;
+}
+
+/**
+ * Gets the number of recorded transactions passed over to find 
+ * the next matching read. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The skip count.
+ */
+unsigned long I2CReplay::skipped() {
+    return this->_skipped;
+}
+
+/**
+ * Match a register write from a driver against the trace.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param address The 7 bit device address.
+ * @param reg The register.
+ * @param value The value written.
+ */
+void I2CReplay::write(uint8_t address, uint8_t reg, uint8_t value) {
+    Record record;
+
+    if (this->parse(this->_pos, this->_time, record) && !record.read 
+        && record.address == address && record.reg == reg) {
+        if (record.length != 1 || record.data[0] != value) {
+            this->_mismatches++;
+        }
+        this->consume(record);
+    } else {
+        this->_mismatches++;
+    }
+}
+
+/**
+ * Match a single byte write from a driver against a recorded 
+ * control write, such as a multiplexer channel switch. A 
+ * single byte that is not one is a register select for the 
+ * next read. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param address The 7 bit device address.
+ * @param value The byte written.
+ * @return true if the next record is this control write; it is 
+ *         used up.
+ */
+bool I2CReplay::control(uint8_t address, uint8_t value) {
+    Record record;
+
+    if (this->parse(this->_pos, this->_time, record) && !record.read 
+        && record.address == address && record.reg == value 
+        && record.length == 1 && record.data[0] == value) {
+        this->consume(record);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Answer a register read from a driver with the next recorded 
+ * read of the same register, skipping anything in between. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param address The 7 bit device address.
+ * @param reg The register (or first register) read.
+ * @param data Receives the recorded bytes.
+ * @param length The number of bytes wanted.
+ * @return The number of bytes supplied. Bytes the capture did
+ *         not have read as zero.
+ */
+uint8_t I2CReplay::read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+    Record record;
+    long pos = this->_pos;
+    unsigned long time = this->_time;
+    unsigned long skipped = 0;
+
+    memset(data, 0, length);
+    while (this->parse(pos, time, record)) {
+        if (record.read && record.address == address && record.reg == reg) {
+            memcpy(data, record.data, record.length < length ? record.length : length);
+            if (record.length < length) {
+                this->_mismatches++;
+            }
+            this->_skipped += skipped;
+            this->consume(record);
+            return length;
+        }
+        pos = record.end;
+        time = record.time;
+        skipped++;
+    }
+
+    this->_mismatches++;
+    return length;
+}
+
+bool I2CReplay::parse(long pos, unsigned long time, Record& record) {
+    if (pos >= this->_size) {
+        return false;
+    }
+
+    uint8_t flags = this->_trace[pos++];
+    record.read = (flags & I2C_TRACE_READ) != 0;
+    record.address = flags & I2C_TRACE_ADDRESS;
+
+    unsigned long delta = 0;
+    uint8_t shift = 0;
+    uint8_t b;
+    do {
+        if (pos >= this->_size) {
+            return false;
+        }
+        b = this->_trace[pos++];
+        delta |= (unsigned long) (b & 0x7F) << shift;
+        shift += 7;
+    } while ((b & 0x80) && shift < 35);
+    record.time = time + delta;
+
+    if (pos + 2 > this->_size) {
+        return false;
+    }
+    record.reg = this->_trace[pos++];
+    record.length = this->_trace[pos++];
+    if (pos + record.length > this->_size) {
+        return false;
+    }
+    record.data = this->_trace + pos;
+    record.end = pos + record.length;
+    return true;
+}
+
+void I2CReplay::consume(const Record& record) {
+    this->_pos = record.end;
+    this->_time = record.time;
+    this->_transactions++;
+    if ((long) (record.time - virtualMicros) > 0) {
+        virtualMicros = record.time;
+    }
+}
+
+TwoWire::TwoWire() {
+    this->_transmitting = false;
+    this->_txLength = 0;
+    this->_rxLength = 0;
+    this->_rxPos = 0;
+}
+
+void TwoWire::begin() {
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    this->_address = address;
+    this->_txLength = 0;
+    this->_transmitting = true;
+}
+
+size_t TwoWire::write(uint8_t value) {
+    if (!this->_transmitting || this->_txLength >= BUFFER_LENGTH) {
+        return 0;
+    }
+    this->_tx[this->_txLength++] = value;
+    return 1;
+}
+
+// One byte is a recorded control write, or else selects the register for
+// the next requestFrom(). More bytes write to consecutive registers. The
+// drivers also call this once after reading, which has nothing to send.
+uint8_t TwoWire::endTransmission(uint8_t stop) {
+    if (!this->_transmitting) {
+        return 0;
+    }
+    this->_transmitting = false;
+
+    if (this->_txLength == 1 && current != 0 && current->control(this->_address, this->_tx[0])) {
+        return 0;
+    }
+    if (this->_txLength > 0) {
+        this->_register = this->_tx[0];
+    }
+    for (uint8_t i=1; i < this->_txLength && current != 0; i++) {
+        current->write(this->_address, this->_register + i - 1, this->_tx[i]);
+    }
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+    if (quantity > BUFFER_LENGTH) {
+        quantity = BUFFER_LENGTH;
+    }
+    this->_rxPos = 0;
+    this->_rxLength = quantity;
+    if (current != 0) {
+        current->read(address, this->_register, this->_rx, quantity);
+    } else {
+        memset(this->_rx, 0, quantity);
+    }
+    return quantity;
+}
+
+int TwoWire::available() {
+    return this->_rxLength - this->_rxPos;
+}
+
+int TwoWire::read() {
+    if (this->_rxPos >= this->_rxLength) {
+        return -1;
+    }
+    return this->_rx[this->_rxPos++];
+}
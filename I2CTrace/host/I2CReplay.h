@@ -0,0 +1,48 @@
+// Feeds the Compass and Gyroscope drivers from a recorded I2C trace
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef I2CReplay_h
+#define I2CReplay_h
+
+#include <stdint.h>
+
+// See .cpp source for method documentation.
+class I2CReplay {
+public:
+    I2CReplay();
+    ~I2CReplay();
+    bool open(const char* path);
+    void rewind();
+    bool done();
+    unsigned long next();
+    void sync();
+    unsigned long transactions();
+    unsigned long mismatches();
+    unsigned long skipped();
+    void write(uint8_t address, uint8_t reg, uint8_t value);
+    bool control(uint8_t address, uint8_t value);
+    uint8_t read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length);
+private:
+    struct Record {
+        bool read;
+        uint8_t address;
+        uint8_t reg;
+        uint8_t length;
+        unsigned long time;
+        const uint8_t* data;
+        long end;
+    };
+    uint8_t* _trace;
+    long _size;
+    long _pos;
+    unsigned long _time;
+    unsigned long _transactions;
+    unsigned long _mismatches;
+    unsigned long _skipped;
+    bool parse(long pos, unsigned long time, Record& record);
+    void consume(const Record& record);
+};
+
+#endif
@@ -0,0 +1,38 @@
+// Host stand-in for the Wire library that answers from an I2C trace
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef TwoWire_h
+#define TwoWire_h
+
+#include "Arduino.h"
+
+#define BUFFER_LENGTH (32)
+
+// Same calls the drivers make on the real Wire object. Transactions are
+// handed to the open I2CReplay.
+class TwoWire {
+public:
+    TwoWire();
+    void begin();
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t value);
+    uint8_t endTransmission(uint8_t stop = 1);
+    uint8_t requestFrom(uint8_t address, uint8_t quantity);
+    int available();
+    int read();
+private:
+    uint8_t _address;
+    uint8_t _tx[BUFFER_LENGTH];
+    uint8_t _txLength;
+    bool _transmitting;
+    uint8_t _register;
+    uint8_t _rx[BUFFER_LENGTH];
+    uint8_t _rxLength;
+    uint8_t _rxPos;
+};
+
+extern TwoWire Wire;
+
+#endif
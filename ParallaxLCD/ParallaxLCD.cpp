@@ -7,6 +7,13 @@
 #include <SoftwareSerial.h>
 #include "ParallaxLCD.h"
 
+#ifdef DRIVER_STATS
+#include <DriverProbe.h>
+#else
+#define DRIVER_PROBE_START()
+#define DRIVER_PROBE_END(probe, miss)
+#endif
+
 /**
  * Constructor. Note that you need to not only include the 
  * Parallax.h file in your sketch, but also SoftwareSerial.h. 
@@ -22,17 +29,211 @@
  */
 ParallaxLCD::ParallaxLCD(int pin, int baud) : SoftwareSerial(pin, pin) {
     _pin = pin;
+    _baud = baud;
+    _queued = false;
+    _uart = 0;
+    _txHead = 0;
+    _txTail = 0;
+    _txBit = 0;
+    _txHold = 0;
+    _holdFor = 0;
     pinMode(pin, OUTPUT);
     begin(baud);
 }
 
 /**
- * Clear the display. Requires 5ms.
+ * Switch to queued output driven by a timer. Commands and text 
+ * are placed in a ring buffer and sent one bit per call to 
+ * txTick(), which must be called from a timer interrupt running 
+ * at the baud rate (e.g. every 104us at 9600 baud). 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void ParallaxLCD::beginQueued() {
+    // The receive side shares the pin, and its pin change interrupt
+    // would run for a whole byte with interrupts off on every start bit.
+    stopListening();
+    _uart = 0;
+    _settleTicks = _baud * (LCD_CLEAR_SETTLE_US / 1000) / 1000;
+    _queued = true;
+}
+
+/**
+ * Switch to queued output drained through a hardware UART. The 
+ * display must be wired to the UART's TX pin. Call service() 
+ * from loop() to move queued bytes into the UART. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param uart The serial port the display is connected to. It 
+ *             is started at the display's baud rate.
+ */
+void ParallaxLCD::beginQueued(HardwareSerial& uart) {
+    _uart = &uart;
+    _uart->begin(_baud);
+    _queued = true;
+}
+
+/**
+ * Wait for the queue to drain and return to writing each byte 
+ * straight to the display. A UART is flushed and released, and 
+ * direct output goes to the pin given at construction again, so 
+ * after UART queued output this only reaches the display if 
+ * that pin is the UART's TX pin. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void ParallaxLCD::endQueued() {
+    while (!txIdle()) {
+        service();
+    }
+    if (_uart != 0) {
+        _uart->flush();
+        _uart->end();
+        _uart = 0;
+        digitalWrite(_pin, HIGH);
+        pinMode(_pin, OUTPUT);
+    }
+    _queued = false;
+}
+
+/**
+ * Move queued bytes into the UART without blocking. Holds back 
+ * the queue while a clear is settling. Does nothing for the 
+ * timer driven or direct output. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void ParallaxLCD::service() {
+    if (!_queued || _uart == 0) {
+        return;
+    }
+
+    while (_txHead != _txTail) {
+        if (_holdFor != 0) {
+            if (micros() - _holdStart < _holdFor) {
+                return;
+            }
+            _holdFor = 0;
+        }
+        if (_uart->availableForWrite() <= 0) {
+            return;
+        }
+
+        int pending = SERIAL_TX_BUFFER_SIZE - 1 - _uart->availableForWrite();
+        _uart->write(_txBuf[_txTail]);
+        if (_txSettle[_txTail / 8] & (1 << (_txTail % 8))) {
+            // Settle counts from the end of the command, which is behind
+            // whatever the UART has yet to send.
+            _holdStart = micros();
+            _holdFor = LCD_CLEAR_SETTLE_US + (pending + 1) * 10000000L / _baud;
+        }
+        _txTail = (_txTail + 1) & (LCD_TX_BUFFER - 1);
+    }
+}
+
+/**
+ * Send the next bit of the queue. Call from a timer interrupt 
+ * at the baud rate when using beginQueued() without a UART. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void ParallaxLCD::txTick() {
+    if (_txHold) {
+        _txHold--;
+        return;
+    }
+
+    if (_txBit == 0) {
+        if (_txHead == _txTail) {
+            return;
+        }
+        _txByte = _txBuf[_txTail];
+        digitalWrite(_pin, LOW);
+        _txBit = 1;
+    } else if (_txBit <= 8) {
+        digitalWrite(_pin, _txByte & 0x01);
+        _txByte >>= 1;
+        _txBit++;
+    } else {
+        digitalWrite(_pin, HIGH);
+        if (_txSettle[_txTail / 8] & (1 << (_txTail % 8))) {
+            _txHold = _settleTicks;
+        }
+        _txTail = (_txTail + 1) & (LCD_TX_BUFFER - 1);
+        _txBit = 0;
+    }
+}
+
+/**
+ * Checks if everything queued has been sent.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return true when the queue is empty and sent, including any 
+ *         clear settle time, or output is direct.
+ */
+bool ParallaxLCD::txIdle() {
+    if (!_queued) {
+        return true;
+    }
+
+    if (_uart != 0) {
+        if (_txHead != _txTail) {
+            return false;
+        }
+        if (_holdFor != 0 && micros() - _holdStart < _holdFor) {
+            return false;
+        }
+        return _uart->availableForWrite() >= SERIAL_TX_BUFFER_SIZE - 1;
+    }
+
+    // _txHold is two bytes and changes in txTick(), so read it with
+    // interrupts off.
+    noInterrupts();
+    bool idle = _txHead == _txTail && _txBit == 0 && _txHold == 0;
+    interrupts();
+    return idle;
+}
+
+/**
+ * Write a byte to the display. In queued mode the byte is added 
+ * to the ring buffer; this only waits if the buffer is full. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param data The byte to send.
+ * @return 1
+ */
+size_t ParallaxLCD::write(uint8_t data) {
+    DRIVER_PROBE_START();
+    if (!_queued) {
+        size_t written = SoftwareSerial::write(data);
+        DRIVER_PROBE_END(DRIVER_LCD_WRITE, false);
+        return written;
+    }
+    // A full queue makes enqueue() wait, so no byte is ever lost.
+    enqueue(data, false);
+    DRIVER_PROBE_END(DRIVER_LCD_WRITE, false);
+    return 1;
+}
+
+/**
+ * Clear the display. Requires 5ms. In queued mode the 5ms is 
+ * held back in the queue rather than slept. 
  * 
  * @author nedwidek (2012/07/01)
  * 
  */
 void ParallaxLCD::clear() {
+    if (_queued) {
+        enqueue(12, true);
+        return;
+    }
     write(12);
     delay(5);
 }
@@ -290,3 +491,19 @@ void ParallaxLCD::setScale(int scale) {
 void ParallaxLCD::setNoteLength(int len) {
     write(len + 208);
 }
+
+void ParallaxLCD::enqueue(uint8_t data, bool settle) {
+    uint8_t next = (_txHead + 1) & (LCD_TX_BUFFER - 1);
+
+    while (next == _txTail) {
+        service();
+    }
+
+    _txBuf[_txHead] = data;
+    if (settle) {
+        _txSettle[_txHead / 8] |= (1 << (_txHead % 8));
+    } else {
+        _txSettle[_txHead / 8] &= ~(1 << (_txHead % 8));
+    }
+    _txHead = next;
+}
@@ -9,9 +9,28 @@
 #include "Arduino.h"
 #include <SoftwareSerial.h>
 
+// Size of the queued mode transmit ring. Must be a power of two.
+#ifndef LCD_TX_BUFFER
+#define LCD_TX_BUFFER       (32)
+#endif
+// Time the display needs after a clear before it accepts more bytes.
+#define LCD_CLEAR_SETTLE_US (5000)
+
+#ifndef SERIAL_TX_BUFFER_SIZE
+#define SERIAL_TX_BUFFER_SIZE (64)
+#endif
+
 class ParallaxLCD : public SoftwareSerial {
 public:
     ParallaxLCD(int pin, int baud);
+    void beginQueued();
+    void beginQueued(HardwareSerial& uart);
+    void endQueued();
+    void service();
+    void txTick();
+    bool txIdle();
+    virtual size_t write(uint8_t data);
+    using Print::write;
     void clear();
     void backlight(bool on);
     void displayMode(bool on, bool cursor, bool blink);
@@ -48,6 +67,20 @@ public:
 
 private:
     int _pin;
+    long _baud;
+    bool _queued;
+    HardwareSerial* _uart;
+    uint8_t _txBuf[LCD_TX_BUFFER];
+    uint8_t _txSettle[LCD_TX_BUFFER / 8];
+    volatile uint8_t _txHead;
+    volatile uint8_t _txTail;
+    volatile uint8_t _txBit;
+    volatile uint8_t _txByte;
+    volatile unsigned int _txHold;
+    unsigned int _settleTicks;
+    unsigned long _holdStart;
+    unsigned long _holdFor;
+    void enqueue(uint8_t data, bool settle);
     void setScale(int);
     void setNoteLength(int);
 };
@@ -0,0 +1,279 @@
+// Shadow framebuffer for the Parallax 2x16 LCD Display (#27976-RT, #27977-RT)
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include <SoftwareSerial.h>
+#include "ParallaxLCDBuffer.h"
+
+// Digits are found by subtracting powers of ten, which is much cheaper than
+// long division on the AVR.
+static const uint32_t POWERS_OF_TEN[10] PROGMEM = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL,
+    1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+/**
+ * Constructor. The contents of the display are unknown at this 
+ * point, so the first flush() redraws every cell. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param lcd The display to draw to.
+ */
+ParallaxLCDBuffer::ParallaxLCDBuffer(ParallaxLCD& lcd) {
+    this->_lcd = &lcd;
+    this->_resume = 0;
+    this->clear();
+    this->invalidate();
+}
+
+/**
+ * Fill the frame with spaces and home the drawing cursor. 
+ * Nothing is sent until flush(). 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void ParallaxLCDBuffer::clear() {
+    memset(this->_frame, ' ', LCD_CELLS);
+    this->_cursor = 0;
+}
+
+/**
+ * Moves the drawing cursor. Text written with print() is placed 
+ * from here. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param row The row, zero indexed. 
+ * @param col The column, zero indexed.
+ */
+void ParallaxLCDBuffer::setCursor(int row, int col) {
+    this->_cursor = row * LCD_COLS + col;
+}
+
+/**
+ * Set a single cell without moving the drawing cursor. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param row The row, zero indexed. 
+ * @param col The column, zero indexed.
+ * @param code The character, or custom character [0...7], to 
+ *             show in the cell.
+ */
+void ParallaxLCDBuffer::setCell(int row, int col, byte code) {
+    this->_frame[row * LCD_COLS + col] = code;
+}
+
+/**
+ * Gets the code drawn in a cell.
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param row The row, zero indexed. 
+ * @param col The column, zero indexed.
+ * @return The character in the frame at that cell.
+ */
+byte ParallaxLCDBuffer::cell(int row, int col) {
+    return this->_frame[row * LCD_COLS + col];
+}
+
+/**
+ * Draw an integer right aligned in a field of cells. See 
+ * printFixed(). 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param row The row, zero indexed. 
+ * @param col The first column of the field, zero indexed.
+ * @param width The number of cells in the field.
+ * @param value The value to draw.
+ * @param pad The character to fill the field with, ' ' or '0'.
+ */
+void ParallaxLCDBuffer::printNumber(int row, int col, uint8_t width, long value, char pad) {
+    this->printFixed(row, col, width, value, 0, pad);
+}
+
+/**
+ * Draw a fixed point number right aligned in a field of cells, 
+ * straight into the frame. No strings, floats or divisions are 
+ * involved. A value too wide for the field fills it with '*'. 
+ * There is no bounds checking, the field must fit on the row. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param row The row, zero indexed. 
+ * @param col The first column of the field, zero indexed.
+ * @param width The number of cells in the field.
+ * @param value The value scaled by 10^decimals, e.g. 215 with 1 
+ *              decimal draws 21.5.
+ * @param decimals The number of digits after the point.
+ * @param pad The character to fill the field with, ' ' or '0'. 
+ *            With '0' the sign comes before the padding.
+ */
+void ParallaxLCDBuffer::printFixed(int row, int col, uint8_t width, long value, uint8_t decimals, char pad) {
+    byte* cells = this->_frame + row * LCD_COLS + col;
+    bool negative = value < 0;
+    unsigned long magnitude = negative ? 0UL - (unsigned long) value : value;
+
+    uint8_t digits = 1;
+    while (digits < 10 && magnitude >= pgm_read_dword(&POWERS_OF_TEN[digits])) {
+        digits++;
+    }
+    if (digits <= decimals) {
+        digits = decimals + 1;
+    }
+
+    uint8_t length = digits + (decimals ? 1 : 0) + (negative ? 1 : 0);
+    if (length > width) {
+        memset(cells, '*', width);
+        return;
+    }
+
+    uint8_t i = 0;
+    if (negative && pad == '0') {
+        cells[i++] = '-';
+    }
+    while (i < width - length + (negative && pad == '0' ? 1 : 0)) {
+        cells[i++] = pad;
+    }
+    if (negative && pad != '0') {
+        cells[i++] = '-';
+    }
+
+    for (uint8_t d=digits; d > 0; d--) {
+        unsigned long power = pgm_read_dword(&POWERS_OF_TEN[d - 1]);
+        byte digit = '0';
+        while (magnitude >= power) {
+            magnitude -= power;
+            digit++;
+        }
+        cells[i++] = digit;
+        if (decimals && d - 1 == decimals) {
+            cells[i++] = '.';
+        }
+    }
+}
+
+/**
+ * Forget what is on the display so the next flush() redraws 
+ * every cell. Call this after anything other than flush() has 
+ * written text to the display, for example ParallaxLCD::clear(). 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void ParallaxLCDBuffer::invalidate() {
+    memset(this->_shadow, LCD_CELL_UNKNOWN, LCD_CELLS);
+    this->_lcdCursor = -1;
+}
+
+/**
+ * Send the cells that differ from what is on the display. A 
+ * short run of unchanged cells between two changes is rewritten 
+ * when that is no more bytes than a moveCursor() jump. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The number of bytes sent.
+ */
+int ParallaxLCDBuffer::flush() {
+    return this->flush(0x7FFF);
+}
+
+/**
+ * As flush(), but send no more than budget bytes. The next call 
+ * carries on from the first cell left unsent, so every cell is 
+ * reached even when earlier ones keep changing. Cells that 
+ * change again before they are sent only go out once. At least 
+ * one changed cell is sent, even if that goes over the budget. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param budget The most bytes to send.
+ * @return The number of bytes sent.
+ */
+int ParallaxLCDBuffer::flush(int budget) {
+    int sent = 0;
+
+    for (int n=0; n < LCD_CELLS; n++) {
+        int i = (this->_resume + n) % LCD_CELLS;
+        if (this->_frame[i] == this->_shadow[i]) {
+            continue;
+        }
+
+        int cost = 1;
+        bool rewrite = false;
+        if (this->_lcdCursor != i) {
+            int gap = i - this->_lcdCursor;
+            rewrite = this->_lcdCursor >= 0 && gap > 0 && gap <= LCD_JUMP_COST
+                && this->_lcdCursor / LCD_COLS == i / LCD_COLS;
+            cost += rewrite ? gap : LCD_JUMP_COST;
+        }
+        // The first cell always goes out, so a budget below one cell's
+        // cost still makes progress.
+        if (sent > 0 && sent + cost > budget) {
+            this->_resume = i;
+            return sent;
+        }
+
+        if (rewrite) {
+            for (int j=this->_lcdCursor; j < i; j++) {
+                this->_lcd->write(this->_frame[j]);
+                this->_shadow[j] = this->_frame[j];
+            }
+        } else if (this->_lcdCursor != i) {
+            this->_lcd->moveCursor(i / LCD_COLS, i % LCD_COLS);
+        }
+
+        this->_lcd->write(this->_frame[i]);
+        this->_shadow[i] = this->_frame[i];
+        sent += cost;
+
+        // Do not rely on how the display wraps at the end of a row.
+        this->_lcdCursor = i + 1;
+        if (this->_lcdCursor % LCD_COLS == 0) {
+            this->_lcdCursor = -1;
+        }
+    }
+
+    this->_resume = 0;
+    return sent;
+}
+
+/**
+ * Gets the display this buffer draws to.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The display.
+ */
+ParallaxLCD& ParallaxLCDBuffer::lcd() {
+    return *this->_lcd;
+}
+
+/**
+ * Place a character at the drawing cursor and advance it. A 
+ * newline moves to the start of the next row. Text past the 
+ * last cell is dropped. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param code The character to draw.
+ * @return 1 if the character was drawn.
+ */
+size_t ParallaxLCDBuffer::write(uint8_t code) {
+    if (code == '\n') {
+        this->_cursor = (this->_cursor / LCD_COLS + 1) * LCD_COLS;
+        return 1;
+    }
+    if (code == '\r' || this->_cursor >= LCD_CELLS) {
+        return 0;
+    }
+
+    this->_frame[this->_cursor++] = code;
+    return 1;
+}
@@ -0,0 +1,52 @@
+// Shadow framebuffer for the Parallax 2x16 LCD Display (#27976-RT, #27977-RT)
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef ParallaxLCDBuffer_h
+#define ParallaxLCDBuffer_h
+
+#include "Arduino.h"
+#include "ParallaxLCD.h"
+
+// Display geometry. Override before including for the 4x20 displays.
+#ifndef LCD_ROWS
+#define LCD_ROWS         (2)
+#endif
+#ifndef LCD_COLS
+#define LCD_COLS         (16)
+#endif
+#define LCD_CELLS        (LCD_ROWS * LCD_COLS)
+
+// Bytes sent by a moveCursor() jump.
+#define LCD_JUMP_COST    (1)
+// Never a displayable code (it is a define custom command), so a shadow
+// cell holding it always differs from the frame.
+#define LCD_CELL_UNKNOWN (0xFF)
+
+// See .cpp source for method documentation.
+class ParallaxLCDBuffer : public Print {
+public:
+    ParallaxLCDBuffer(ParallaxLCD& lcd);
+    void clear();
+    void setCursor(int row, int col);
+    void setCell(int row, int col, byte code);
+    byte cell(int row, int col);
+    void printNumber(int row, int col, uint8_t width, long value, char pad = ' ');
+    void printFixed(int row, int col, uint8_t width, long value, uint8_t decimals, char pad = ' ');
+    void invalidate();
+    int flush();
+    int flush(int budget);
+    ParallaxLCD& lcd();
+    virtual size_t write(uint8_t code);
+    using Print::write;
+private:
+    ParallaxLCD* _lcd;
+    byte _frame[LCD_CELLS];
+    byte _shadow[LCD_CELLS];
+    uint8_t _cursor;
+    int _lcdCursor;
+    uint8_t _resume;
+};
+
+#endif
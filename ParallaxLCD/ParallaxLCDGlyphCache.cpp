@@ -0,0 +1,157 @@
+// LRU cache of custom characters for the Parallax LCD Displays
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include <SoftwareSerial.h>
+#include "ParallaxLCDGlyphCache.h"
+
+/**
+ * Constructor. Assumes none of the display's custom characters 
+ * hold anything we know about. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param lcd The display whose custom characters are managed.
+ */
+ParallaxLCDGlyphCache::ParallaxLCDGlyphCache(ParallaxLCD& lcd) {
+    this->_lcd = &lcd;
+    this->reset();
+}
+
+/**
+ * Gets the custom character slot holding a glyph, uploading the 
+ * glyph over the least recently used slot if it is not loaded. 
+ * Cells already showing the evicted slot will change to the new 
+ * glyph, so keep no more than 8 glyphs on screen at once. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param id Any number identifying the glyph. The same id must 
+ *           always be used with the same bitmap.
+ * @param bitmap The 8 row bitmap, see 
+ *               ParallaxLCD::defineCustom().
+ * @return The slot [0...7], which is also the character code to 
+ *         display it with.
+ */
+uint8_t ParallaxLCDGlyphCache::slot(uint16_t id, const byte bitmap[]) {
+    int8_t found = this->lookup(id);
+    if (found >= 0) {
+        return found;
+    }
+
+    uint8_t slot = this->victim();
+    this->_lcd->defineCustom(slot, (byte*) bitmap);
+    this->_ids[slot] = id;
+    this->touch(slot);
+    return slot;
+}
+
+/**
+ * As slot(), but with the bitmap stored in PROGMEM.
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param id Any number identifying the glyph.
+ * @param bitmap The 8 row bitmap in program memory.
+ * @return The slot [0...7].
+ */
+uint8_t ParallaxLCDGlyphCache::slot_P(uint16_t id, const byte bitmap[]) {
+    int8_t found = this->lookup(id);
+    if (found >= 0) {
+        return found;
+    }
+
+    byte rows[8];
+    for (uint8_t i=0; i < 8; i++) {
+        rows[i] = pgm_read_byte(bitmap + i);
+    }
+
+    uint8_t slot = this->victim();
+    this->_lcd->defineCustom(slot, rows);
+    this->_ids[slot] = id;
+    this->touch(slot);
+    return slot;
+}
+
+/**
+ * Display a glyph at the current cursor position, loading it 
+ * first if needed. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param id Any number identifying the glyph.
+ * @param bitmap The 8 row bitmap.
+ */
+void ParallaxLCDGlyphCache::display(uint16_t id, const byte bitmap[]) {
+    this->_lcd->displayCustom(this->slot(id, bitmap));
+}
+
+/**
+ * Forget every loaded glyph and clear the counters.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void ParallaxLCDGlyphCache::reset() {
+    for (uint8_t i=0; i < LCD_GLYPH_SLOTS; i++) {
+        this->_ids[i] = LCD_GLYPH_NONE;
+        this->_rank[i] = i;
+    }
+    this->_hits = 0;
+    this->_misses = 0;
+}
+
+/**
+ * Gets the number of lookups that found the glyph loaded.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The hit count.
+ */
+unsigned long ParallaxLCDGlyphCache::hits() {
+    return this->_hits;
+}
+
+/**
+ * Gets the number of lookups that had to upload the glyph.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The miss count.
+ */
+unsigned long ParallaxLCDGlyphCache::misses() {
+    return this->_misses;
+}
+
+int8_t ParallaxLCDGlyphCache::lookup(uint16_t id) {
+    for (uint8_t i=0; i < LCD_GLYPH_SLOTS; i++) {
+        if (this->_ids[i] == id) {
+            this->_hits++;
+            this->touch(i);
+            return i;
+        }
+    }
+    this->_misses++;
+    return -1;
+}
+
+uint8_t ParallaxLCDGlyphCache::victim() {
+    for (uint8_t i=0; i < LCD_GLYPH_SLOTS; i++) {
+        if (this->_rank[i] == LCD_GLYPH_SLOTS - 1) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+// Ranks run from 0 (most recently used) to 7 (least recently used).
+void ParallaxLCDGlyphCache::touch(uint8_t slot) {
+    for (uint8_t i=0; i < LCD_GLYPH_SLOTS; i++) {
+        if (this->_rank[i] < this->_rank[slot]) {
+            this->_rank[i]++;
+        }
+    }
+    this->_rank[slot] = 0;
+}
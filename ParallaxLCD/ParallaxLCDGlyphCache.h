@@ -0,0 +1,38 @@
+// LRU cache of custom characters for the Parallax LCD Displays
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef ParallaxLCDGlyphCache_h
+#define ParallaxLCDGlyphCache_h
+
+#include "Arduino.h"
+#include "ParallaxLCD.h"
+
+// Number of custom character slots on the display.
+#define LCD_GLYPH_SLOTS (8)
+// Glyph id marking an empty slot.
+#define LCD_GLYPH_NONE  (0xFFFF)
+
+// See .cpp source for method documentation.
+class ParallaxLCDGlyphCache {
+public:
+    ParallaxLCDGlyphCache(ParallaxLCD& lcd);
+    uint8_t slot(uint16_t id, const byte bitmap[]);
+    uint8_t slot_P(uint16_t id, const byte bitmap[]);
+    void display(uint16_t id, const byte bitmap[]);
+    void reset();
+    unsigned long hits();
+    unsigned long misses();
+private:
+    ParallaxLCD* _lcd;
+    uint16_t _ids[LCD_GLYPH_SLOTS];
+    uint8_t _rank[LCD_GLYPH_SLOTS];
+    unsigned long _hits;
+    unsigned long _misses;
+    int8_t lookup(uint16_t id);
+    uint8_t victim();
+    void touch(uint8_t slot);
+};
+
+#endif
@@ -0,0 +1,211 @@
+// Bar graphs and big digits for the Parallax 2x16 LCD Display
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include <SoftwareSerial.h>
+#include "ParallaxLCDGraphics.h"
+
+// Custom characters used by the horizontal bar set.
+#define GLYPH_FULL      (4)
+#define GLYPH_TOP       (5)
+#define GLYPH_BOTTOM    (6)
+#define GLYPH_BOTH      (7)
+#define GLYPH_BLANK     (' ')
+
+// Slots 0-3 are bars 1-4 columns wide, 4 is a full block and 5-7 are the
+// top, bottom and top plus bottom strokes the big digits are built from.
+static const byte HBAR_GLYPHS[8][8] PROGMEM = {
+    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+    { 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },
+    { 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C },
+    { 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E },
+    { 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F },
+    { 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F },
+    { 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F }
+};
+
+// Slot n is a bar n + 1 rows tall.
+static const byte VBAR_GLYPHS[8][8] PROGMEM = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F },
+    { 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F },
+    { 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F },
+    { 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F },
+    { 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F },
+    { 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F }
+};
+
+// Top row then bottom row for 0-9, blank and minus.
+static const byte BIG_DIGITS[12][6] PROGMEM = {
+    { GLYPH_FULL, GLYPH_TOP, GLYPH_FULL,  GLYPH_FULL, GLYPH_BOTTOM, GLYPH_FULL },
+    { GLYPH_TOP, GLYPH_FULL, GLYPH_BLANK,  GLYPH_BOTTOM, GLYPH_FULL, GLYPH_BOTTOM },
+    { GLYPH_BOTH, GLYPH_BOTH, GLYPH_FULL,  GLYPH_FULL, GLYPH_BOTTOM, GLYPH_BOTTOM },
+    { GLYPH_BOTH, GLYPH_BOTH, GLYPH_FULL,  GLYPH_BOTTOM, GLYPH_BOTTOM, GLYPH_FULL },
+    { GLYPH_FULL, GLYPH_BOTTOM, GLYPH_FULL,  GLYPH_BLANK, GLYPH_BLANK, GLYPH_FULL },
+    { GLYPH_FULL, GLYPH_BOTH, GLYPH_BOTH,  GLYPH_BOTTOM, GLYPH_BOTTOM, GLYPH_FULL },
+    { GLYPH_FULL, GLYPH_BOTH, GLYPH_BOTH,  GLYPH_FULL, GLYPH_BOTTOM, GLYPH_FULL },
+    { GLYPH_TOP, GLYPH_TOP, GLYPH_FULL,  GLYPH_BLANK, GLYPH_BLANK, GLYPH_FULL },
+    { GLYPH_FULL, GLYPH_BOTH, GLYPH_FULL,  GLYPH_FULL, GLYPH_BOTTOM, GLYPH_FULL },
+    { GLYPH_FULL, GLYPH_BOTH, GLYPH_FULL,  GLYPH_BOTTOM, GLYPH_BOTTOM, GLYPH_FULL },
+    { GLYPH_BLANK, GLYPH_BLANK, GLYPH_BLANK,  GLYPH_BLANK, GLYPH_BLANK, GLYPH_BLANK },
+    { GLYPH_BOTTOM, GLYPH_BOTTOM, GLYPH_BOTTOM,  GLYPH_BLANK, GLYPH_BLANK, GLYPH_BLANK }
+};
+
+/**
+ * Constructor.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param buffer The framebuffer to draw into. Nothing reaches 
+ *               the display until its flush().
+ */
+ParallaxLCDGraphics::ParallaxLCDGraphics(ParallaxLCDBuffer& buffer) {
+    this->_buffer = &buffer;
+}
+
+/**
+ * Upload a glyph set to the display's custom characters. This 
+ * is the only time bitmaps are sent; drawing afterwards only 
+ * changes cell codes. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param glyphs LCD_GLYPHS_HBAR for hbar() and the big digits, 
+ *               or LCD_GLYPHS_VBAR for vbar().
+ */
+void ParallaxLCDGraphics::begin(uint8_t glyphs) {
+    const byte (*set)[8] = glyphs == LCD_GLYPHS_VBAR ? VBAR_GLYPHS : HBAR_GLYPHS;
+    byte rows[8];
+
+    for (uint8_t custom=0; custom < 8; custom++) {
+        for (uint8_t i=0; i < 8; i++) {
+            rows[i] = pgm_read_byte(&set[custom][i]);
+        }
+        this->_buffer->lcd().defineCustom(custom, rows);
+    }
+}
+
+/**
+ * Draw a horizontal bar with 5 steps per cell. Needs 
+ * LCD_GLYPHS_HBAR. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param row The row, zero indexed. 
+ * @param col The first column of the bar, zero indexed.
+ * @param width The length of the bar in cells.
+ * @param value The value to show, clamped to 0 - max.
+ * @param max The value of a full bar.
+ */
+void ParallaxLCDGraphics::hbar(int row, int col, uint8_t width, long value, long max) {
+    if (value < 0) {
+        value = 0;
+    } else if (value > max) {
+        value = max;
+    }
+    int filled = max > 0 ? value * width * 5 / max : 0;
+
+    for (uint8_t i=0; i < width; i++) {
+        int steps = filled - i * 5;
+        byte code;
+        if (steps <= 0) {
+            code = ' ';
+        } else if (steps >= 5) {
+            code = GLYPH_FULL;
+        } else {
+            code = steps - 1;
+        }
+        this->_buffer->setCell(row, col + i, code);
+    }
+}
+
+/**
+ * Draw a vertical bar up a whole column with 8 steps per cell. 
+ * Needs LCD_GLYPHS_VBAR. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param col The column, zero indexed.
+ * @param value The value to show, clamped to 0 - max.
+ * @param max The value of a full bar.
+ */
+void ParallaxLCDGraphics::vbar(int col, long value, long max) {
+    if (value < 0) {
+        value = 0;
+    } else if (value > max) {
+        value = max;
+    }
+    int filled = max > 0 ? value * LCD_ROWS * 8 / max : 0;
+
+    for (uint8_t i=0; i < LCD_ROWS; i++) {
+        int steps = filled - i * 8;
+        byte code;
+        if (steps <= 0) {
+            code = ' ';
+        } else if (steps >= 8) {
+            code = 7;
+        } else {
+            code = steps - 1;
+        }
+        this->_buffer->setCell(LCD_ROWS - 1 - i, col, code);
+    }
+}
+
+/**
+ * Draw a big digit over the top two rows. Needs 
+ * LCD_GLYPHS_HBAR. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param col The left column of the digit, zero indexed.
+ * @param digit 0 - 9, LCD_BIG_BLANK or LCD_BIG_MINUS.
+ */
+void ParallaxLCDGraphics::bigDigit(int col, uint8_t digit) {
+    for (uint8_t i=0; i < LCD_BIG_WIDTH; i++) {
+        this->_buffer->setCell(0, col + i, pgm_read_byte(&BIG_DIGITS[digit][i]));
+        this->_buffer->setCell(1, col + i, pgm_read_byte(&BIG_DIGITS[digit][LCD_BIG_WIDTH + i]));
+    }
+}
+
+/**
+ * Draw a number in big digits, right aligned. Each digit takes 
+ * LCD_BIG_PITCH columns, so 4 fit across a 16 column display. 
+ * A number that does not fit is shown as all minus signs. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param col The left column of the field, zero indexed.
+ * @param digits The number of digit positions in the field, at
+ *               most LCD_BIG_MAX_DIGITS.
+ * @param value The value to show.
+ */
+void ParallaxLCDGraphics::bigNumber(int col, uint8_t digits, long value) {
+    bool negative = value < 0;
+    unsigned long magnitude = negative ? 0UL - (unsigned long) value : value;
+    uint8_t glyph[LCD_BIG_MAX_DIGITS];
+
+    if (digits > LCD_BIG_MAX_DIGITS) {
+        digits = LCD_BIG_MAX_DIGITS;
+    }
+
+    for (uint8_t i=digits; i > 0; i--) {
+        if (magnitude == 0 && i < digits) {
+            glyph[i - 1] = negative ? LCD_BIG_MINUS : LCD_BIG_BLANK;
+            negative = false;
+        } else {
+            glyph[i - 1] = magnitude % 10;
+            magnitude /= 10;
+        }
+    }
+    if (magnitude != 0 || negative) {
+        memset(glyph, LCD_BIG_MINUS, digits);
+    }
+
+    for (uint8_t i=0; i < digits; i++) {
+        this->bigDigit(col + i * LCD_BIG_PITCH, glyph[i]);
+    }
+}
@@ -0,0 +1,38 @@
+// Bar graphs and big digits for the Parallax 2x16 LCD Display
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef ParallaxLCDGraphics_h
+#define ParallaxLCDGraphics_h
+
+#include "Arduino.h"
+#include "ParallaxLCDBuffer.h"
+
+// Glyph sets. Each fills all 8 custom characters, so only one can be
+// loaded at a time and they do not mix with ParallaxLCDGlyphCache.
+#define LCD_GLYPHS_HBAR     (0)     // Horizontal bars and big digits
+#define LCD_GLYPHS_VBAR     (1)     // Vertical bars
+
+// Big digits are 3 cells wide and 2 rows tall, drawn every 4 columns.
+#define LCD_BIG_WIDTH       (3)
+#define LCD_BIG_PITCH       (4)
+#define LCD_BIG_BLANK       (10)
+#define LCD_BIG_MINUS       (11)
+// Most big digits across the display.
+#define LCD_BIG_MAX_DIGITS  ((LCD_COLS + LCD_BIG_PITCH - LCD_BIG_WIDTH) / LCD_BIG_PITCH)
+
+// See .cpp source for method documentation.
+class ParallaxLCDGraphics {
+public:
+    ParallaxLCDGraphics(ParallaxLCDBuffer& buffer);
+    void begin(uint8_t glyphs);
+    void hbar(int row, int col, uint8_t width, long value, long max);
+    void vbar(int col, long value, long max);
+    void bigDigit(int col, uint8_t digit);
+    void bigNumber(int col, uint8_t digits, long value);
+private:
+    ParallaxLCDBuffer* _buffer;
+};
+
+#endif
@@ -0,0 +1,185 @@
+// Scrolling text regions for the Parallax 2x16 LCD Display
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include <SoftwareSerial.h>
+#include "ParallaxLCDMarquee.h"
+
+/**
+ * Constructor. Regions are drawn into the buffer, which only 
+ * sends the cells a scroll step actually changes. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param buffer The frame to draw into.
+ */
+ParallaxLCDMarquee::ParallaxLCDMarquee(ParallaxLCDBuffer& buffer) {
+    this->_buffer = &buffer;
+    for (uint8_t i=0; i < LCD_MARQUEE_REGIONS; i++) {
+        this->_regions[i].width = 0;
+    }
+}
+
+/**
+ * Add a region of a row that scrolls text longer than its 
+ * width one cell to the left every stepMs. Text that fits is 
+ * drawn once and left still. The text is not copied and must 
+ * stay in place while it is shown. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param row The row of the region.
+ * @param col The first column of the region.
+ * @param width The number of columns in the region.
+ * @param text The text to show.
+ * @param stepMs Time between scroll steps in milliseconds.
+ * @return The region number, or -1 if all are in use or the 
+ *         region is off the display.
+ */
+int8_t ParallaxLCDMarquee::add(int row, int col, uint8_t width, const char* text, unsigned int stepMs) {
+    if (row < 0 || row >= LCD_ROWS || col < 0 || col >= LCD_COLS || width == 0) {
+        return -1;
+    }
+    for (int8_t i=0; i < LCD_MARQUEE_REGIONS; i++) {
+        if (this->_regions[i].width == 0) {
+            Region& region = this->_regions[i];
+            region.row = row;
+            region.col = col;
+            region.width = col + width > LCD_COLS ? LCD_COLS - col : width;
+            region.stepMs = stepMs;
+            this->set(i, text, false);
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * As add(), but with the text stored in PROGMEM.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param row The row of the region.
+ * @param col The first column of the region.
+ * @param width The number of columns in the region.
+ * @param text The text to show, in PROGMEM.
+ * @param stepMs Time between scroll steps in milliseconds.
+ * @return The region number, or -1 if all are in use or the 
+ *         region is off the display.
+ */
+int8_t ParallaxLCDMarquee::add_P(int row, int col, uint8_t width, const char* text, unsigned int stepMs) {
+    int8_t region = this->add(row, col, width, "", stepMs);
+    if (region >= 0) {
+        this->set(region, text, true);
+    }
+    return region;
+}
+
+/**
+ * Show new text in a region, starting from its first 
+ * character. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param region The region number from add().
+ * @param text The text to show.
+ */
+void ParallaxLCDMarquee::setText(int8_t region, const char* text) {
+    this->set(region, text, false);
+}
+
+/**
+ * As setText(), but with the text stored in PROGMEM.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param region The region number from add().
+ * @param text The text to show, in PROGMEM.
+ */
+void ParallaxLCDMarquee::setText_P(int8_t region, const char* text) {
+    this->set(region, text, true);
+}
+
+/**
+ * Stop scrolling a region. Its cells keep their last contents.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param region The region number from add().
+ */
+void ParallaxLCDMarquee::remove(int8_t region) {
+    if (region >= 0 && region < LCD_MARQUEE_REGIONS) {
+        this->_regions[region].width = 0;
+    }
+}
+
+/**
+ * Advance every region that is due a step, then send up to 
+ * budget bytes of changes. Call from loop(); the display is 
+ * brought up to date over as many calls as it takes, and steps 
+ * that come round before the last one was sent replace it 
+ * rather than queue behind it. A late call skips steps so the 
+ * text keeps its speed. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param budget The most bytes to send.
+ * @return The number of bytes sent.
+ */
+int ParallaxLCDMarquee::poll(int budget) {
+    unsigned long now = millis();
+
+    for (uint8_t i=0; i < LCD_MARQUEE_REGIONS; i++) {
+        Region& region = this->_regions[i];
+        if (region.width == 0 || region.length <= region.width || region.stepMs == 0) {
+            continue;
+        }
+
+        unsigned long elapsed = now - region.lastStep;
+        if (elapsed < region.stepMs) {
+            continue;
+        }
+        unsigned long steps = elapsed / region.stepMs;
+        region.lastStep += steps * region.stepMs;
+        region.offset = (region.offset + steps) % (region.length + LCD_MARQUEE_GAP);
+        this->render(region);
+    }
+
+    return this->_buffer->flush(budget);
+}
+
+void ParallaxLCDMarquee::set(int8_t region, const char* text, bool progmem) {
+    if (region < 0 || region >= LCD_MARQUEE_REGIONS || this->_regions[region].width == 0) {
+        return;
+    }
+
+    Region& r = this->_regions[region];
+    r.text = text;
+    r.progmem = progmem;
+    r.length = progmem ? strlen_P(text) : strlen(text);
+    r.offset = 0;
+    r.lastStep = millis();
+    this->render(r);
+}
+
+// Draw the window of the text at the current offset. The text repeats
+// with LCD_MARQUEE_GAP blanks between the end and the start.
+void ParallaxLCDMarquee::render(Region& region) {
+    uint16_t period = region.length + LCD_MARQUEE_GAP;
+    uint16_t pos = region.offset;
+
+    for (uint8_t i=0; i < region.width; i++) {
+        char c = ' ';
+        if (pos < region.length) {
+            c = region.progmem ? pgm_read_byte(region.text + pos) : region.text[pos];
+        }
+        this->_buffer->setCell(region.row, region.col + i, c);
+
+        // Text that fits is shown once rather than repeated.
+        if (++pos >= period && region.length > region.width) {
+            pos = 0;
+        }
+    }
+}
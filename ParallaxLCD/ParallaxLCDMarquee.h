@@ -0,0 +1,49 @@
+// Scrolling text regions for the Parallax 2x16 LCD Display
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef ParallaxLCDMarquee_h
+#define ParallaxLCDMarquee_h
+
+#include "Arduino.h"
+#include "ParallaxLCDBuffer.h"
+
+// Most scrolling regions at once.
+#ifndef LCD_MARQUEE_REGIONS
+#define LCD_MARQUEE_REGIONS (4)
+#endif
+// Blank cells between the end of the text and its start coming round.
+#define LCD_MARQUEE_GAP     (3)
+// Bytes poll() sends per call by default, about 1ms each at 9600 baud.
+#define LCD_MARQUEE_BUDGET  (8)
+
+// See .cpp source for method documentation.
+class ParallaxLCDMarquee {
+public:
+    ParallaxLCDMarquee(ParallaxLCDBuffer& buffer);
+    int8_t add(int row, int col, uint8_t width, const char* text, unsigned int stepMs);
+    int8_t add_P(int row, int col, uint8_t width, const char* text, unsigned int stepMs);
+    void setText(int8_t region, const char* text);
+    void setText_P(int8_t region, const char* text);
+    void remove(int8_t region);
+    int poll(int budget = LCD_MARQUEE_BUDGET);
+private:
+    struct Region {
+        const char* text;
+        uint16_t length;
+        uint16_t offset;
+        unsigned int stepMs;
+        unsigned long lastStep;
+        uint8_t row;
+        uint8_t col;
+        uint8_t width;
+        bool progmem;
+    };
+    ParallaxLCDBuffer* _buffer;
+    Region _regions[LCD_MARQUEE_REGIONS];
+    void set(int8_t region, const char* text, bool progmem);
+    void render(Region& region);
+};
+
+#endif
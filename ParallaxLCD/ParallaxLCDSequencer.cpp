@@ -0,0 +1,155 @@
+// Song compiler and background player for the Parallax LCD piezo speaker
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include <SoftwareSerial.h>
+#include "ParallaxLCDSequencer.h"
+
+/**
+ * Constructor.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param lcd The display with the piezo speaker.
+ */
+ParallaxLCDSequencer::ParallaxLCDSequencer(ParallaxLCD& lcd) {
+    this->_lcd = &lcd;
+    this->_song = 0;
+}
+
+/**
+ * Compile notes into a song. A song is the display's own 
+ * command bytes, one per note, with the scale and length 
+ * commands only where they change (a rest needs no scale). 
+ * Compile once, e.g. on the host or in a setup sketch, and keep 
+ * the result in PROGMEM for play_P(). 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param notes The notes to compile.
+ * @param count The number of notes.
+ * @param song Receives the compiled song.
+ * @param size The size of song in bytes.
+ * @return The length of the compiled song, or -1 if it did not 
+ *         fit.
+ */
+int ParallaxLCDSequencer::compile(const LCDNote notes[], int count, byte song[], int size) {
+    int length = 0;
+    int scale = -1;
+    int noteLength = -1;
+
+    for (int i=0; i < count; i++) {
+        if (notes[i].length != noteLength) {
+            if (length >= size) {
+                return -1;
+            }
+            noteLength = notes[i].length;
+            song[length++] = LCD_CMD_LENGTH + noteLength;
+        }
+        if (notes[i].note != ParallaxLCD::PAUSE && notes[i].scale != scale) {
+            if (length >= size) {
+                return -1;
+            }
+            scale = notes[i].scale;
+            song[length++] = LCD_CMD_SCALE + scale;
+        }
+        if (length >= size) {
+            return -1;
+        }
+        song[length++] = notes[i].note;
+    }
+
+    return length;
+}
+
+/**
+ * Start playing a compiled song held in RAM. The song is sent a 
+ * note at a time from poll(), so it must stay in scope until 
+ * it finishes. 
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param song The compiled song.
+ * @param length The length of the song in bytes.
+ */
+void ParallaxLCDSequencer::play(const byte song[], int length) {
+    this->_song = song;
+    this->_length = length;
+    this->_pos = 0;
+    this->_progmem = false;
+    this->_noteMs = LCD_WHOLE_NOTE_MS >> 2;
+    this->_start = millis();
+    this->_wait = 0;
+}
+
+/**
+ * Start playing a compiled song held in PROGMEM.
+ * 
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param song The compiled song in program memory.
+ * @param length The length of the song in bytes.
+ */
+void ParallaxLCDSequencer::play_P(const byte song[], int length) {
+    this->play(song, length);
+    this->_progmem = true;
+}
+
+/**
+ * Stop playing. The note currently sounding finishes.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void ParallaxLCDSequencer::stop() {
+    this->_song = 0;
+}
+
+/**
+ * Checks if a song is playing.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return true until the last note has been sent.
+ */
+bool ParallaxLCDSequencer::playing() {
+    return this->_song != 0;
+}
+
+/**
+ * Send the next note once the previous one has finished. Call 
+ * from loop(). Only a few bytes are written per note, and with 
+ * the display in queued mode they do not block at all. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void ParallaxLCDSequencer::poll() {
+    if (this->_song == 0 || millis() - this->_start < this->_wait) {
+        return;
+    }
+
+    while (this->_pos < this->_length) {
+        byte code;
+        if (this->_progmem) {
+            code = pgm_read_byte(this->_song + this->_pos);
+        } else {
+            code = this->_song[this->_pos];
+        }
+        this->_pos++;
+        this->_lcd->write(code);
+
+        if (code >= LCD_CMD_LENGTH && code < LCD_CMD_LENGTH + 7) {
+            this->_noteMs = LCD_WHOLE_NOTE_MS >> (6 - (code - LCD_CMD_LENGTH));
+        } else if (code >= ParallaxLCD::A) {
+            // Pace from when this note was due so rounding does not drift.
+            this->_start += this->_wait;
+            this->_wait = this->_noteMs;
+            return;
+        }
+    }
+
+    this->_song = 0;
+}
@@ -0,0 +1,47 @@
+// Song compiler and background player for the Parallax LCD piezo speaker
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef ParallaxLCDSequencer_h
+#define ParallaxLCDSequencer_h
+
+#include "Arduino.h"
+#include "ParallaxLCD.h"
+
+// Length of a whole note on the display, in milliseconds.
+#define LCD_WHOLE_NOTE_MS   (2000)
+
+// Command codes that make up a compiled song.
+#define LCD_CMD_LENGTH      (208)
+#define LCD_CMD_SCALE       (212)
+
+// One note of a song before compiling.
+struct LCDNote {
+    uint8_t scale;      // 3 - 7
+    uint8_t length;     // 0 (64th) - 6 (whole)
+    uint8_t note;       // ParallaxLCD::A ... ParallaxLCD::PAUSE
+};
+
+// See .cpp source for method documentation.
+class ParallaxLCDSequencer {
+public:
+    ParallaxLCDSequencer(ParallaxLCD& lcd);
+    static int compile(const LCDNote notes[], int count, byte song[], int size);
+    void play(const byte song[], int length);
+    void play_P(const byte song[], int length);
+    void stop();
+    bool playing();
+    void poll();
+private:
+    ParallaxLCD* _lcd;
+    const byte* _song;
+    int _length;
+    int _pos;
+    bool _progmem;
+    unsigned int _noteMs;
+    unsigned long _start;
+    unsigned long _wait;
+};
+
+#endif
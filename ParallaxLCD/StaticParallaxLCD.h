@@ -0,0 +1,76 @@
+// Compile time configured Parallax LCD Display (#27976-RT, #27977-RT, #27979-RT)
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef StaticParallaxLCD_h
+#define StaticParallaxLCD_h
+
+#include "Arduino.h"
+
+// Time a digitalWrite() takes, taken off each bit delay.
+#ifndef STATIC_LCD_WRITE_US
+#define STATIC_LCD_WRITE_US (4)
+#endif
+
+// Parallax LCD with the pin and baud rate fixed at compile time. Bytes
+// are bit-banged directly instead of through a SoftwareSerial object, and
+// all methods are static, so it takes no RAM at all:
+//   typedef StaticParallaxLCD<3, 19200> Lcd;
+//   Lcd::begin();
+//   Lcd::print("Hello");
+template <uint8_t PIN, long BAUD = 9600>
+class StaticParallaxLCD {
+public:
+    static void begin() {
+        digitalWrite(PIN, HIGH);
+        pinMode(PIN, OUTPUT);
+    }
+    static void write(uint8_t data) {
+        noInterrupts();
+        digitalWrite(PIN, LOW);
+        delayMicroseconds(BIT_US);
+        for (uint8_t i=0; i < 8; i++) {
+            digitalWrite(PIN, data & 0x01);
+            delayMicroseconds(BIT_US);
+            data >>= 1;
+        }
+        digitalWrite(PIN, HIGH);
+        interrupts();
+        delayMicroseconds(BIT_US);
+    }
+    static void print(const char* text) {
+        while (*text) {
+            write(*text++);
+        }
+    }
+    static void clear() {
+        write(12);
+        delay(5);
+    }
+    static void backlight(bool on) {
+        write(on ? 17 : 18);
+    }
+    static void displayMode(bool on, bool cursor, bool blink) {
+        write(on ? 22 + (cursor ? 2 : 0) + (blink ? 1 : 0) : 21);
+    }
+    static void moveCursor(int row, int col) {
+        write(128 + row * 20 + col);
+    }
+    static void defineCustom(int custom, const byte data[]) {
+        write(custom + 248);
+        for (uint8_t i=0; i < 8; i++) {
+            write(data[i]);
+        }
+    }
+    static void displayCustom(int custom) {
+        write(custom);
+    }
+    static void playNote(int note) {
+        write(note);
+    }
+private:
+    static const unsigned int BIT_US = 1000000L / BAUD - STATIC_LCD_WRITE_US;
+};
+
+#endif
@@ -0,0 +1,138 @@
+// Host stand-in for the Arduino core, enough to build the LCD classes
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// Put this directory first on the include path to build ParallaxLCD and
+// ParallaxLCDBuffer on a PC. Print follows the core's own formatting
+// (including printFloat) so output can be compared byte for byte.
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define pgm_read_byte(p)    (*(const uint8_t*) (p))
+#define pgm_read_word(p)    (*(const uint16_t*) (p))
+#define pgm_read_dword(p)   (*(const uint32_t*) (p))
+#define strlen_P(s)         strlen(s)
+
+#define LOW                 (0)
+#define HIGH                (1)
+#define INPUT               (0)
+#define OUTPUT              (1)
+#define DEC                 (10)
+
+// Time does not pass on its own; delay() moves it on.
+inline unsigned long& hostMicros() {
+    static unsigned long now = 0;
+    return now;
+}
+inline unsigned long micros() { return hostMicros(); }
+inline unsigned long millis() { return hostMicros() / 1000; }
+inline void delay(unsigned long ms) { hostMicros() += ms * 1000; }
+inline void delayMicroseconds(unsigned int us) { hostMicros() += us; }
+
+inline void pinMode(uint8_t pin, uint8_t mode) {}
+inline void digitalWrite(uint8_t pin, uint8_t value) {}
+inline int digitalRead(uint8_t pin) { return LOW; }
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t value) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            n += this->write(*buffer++);
+        }
+        return n;
+    }
+    size_t write(const char* str) {
+        return this->write((const uint8_t*) str, strlen(str));
+    }
+    size_t print(const char* str) { return this->write(str); }
+    size_t print(char c) { return this->write((uint8_t) c); }
+    size_t print(int n, int base = DEC) { return this->print((long) n, base); }
+    size_t print(unsigned int n, int base = DEC) { return this->print((unsigned long) n, base); }
+    size_t print(long n, int base = DEC) {
+        if (n < 0 && base == DEC) {
+            return this->print('-') + this->printNumber(-n, base);
+        }
+        return this->printNumber(n, base);
+    }
+    size_t print(unsigned long n, int base = DEC) { return this->printNumber(n, base); }
+    size_t print(double number, int digits = 2) { return this->printFloat(number, digits); }
+    size_t println() { return this->write("\r\n"); }
+private:
+    size_t printNumber(unsigned long n, uint8_t base) {
+        char buf[8 * sizeof(long) + 1];
+        char* str = &buf[sizeof(buf) - 1];
+        *str = '\0';
+        do {
+            char c = n % base;
+            n /= base;
+            *--str = c < 10 ? c + '0' : c + 'A' - 10;
+        } while (n);
+        return this->write(str);
+    }
+    size_t printFloat(double number, uint8_t digits) {
+        size_t n = 0;
+        if (isnan(number)) return this->print("nan");
+        if (isinf(number)) return this->print("inf");
+        if (number > 4294967040.0 || number < -4294967040.0) return this->print("ovf");
+        if (number < 0.0) {
+            n += this->print('-');
+            number = -number;
+        }
+        double rounding = 0.5;
+        for (uint8_t i=0; i < digits; i++) {
+            rounding /= 10.0;
+        }
+        number += rounding;
+        unsigned long whole = (unsigned long) number;
+        double remainder = number - (double) whole;
+        n += this->print(whole);
+        if (digits > 0) {
+            n += this->print('.');
+        }
+        while (digits-- > 0) {
+            remainder *= 10.0;
+            unsigned int digit = (unsigned int) remainder;
+            n += this->print(digit);
+            remainder -= digit;
+        }
+        return n;
+    }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud) {}
+    void end() {}
+    virtual void flush() {}
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+    virtual int peek() { return -1; }
+    virtual int availableForWrite() { return 64; }
+    virtual size_t write(uint8_t value) { return 1; }
+    using Print::write;
+};
+
+#endif
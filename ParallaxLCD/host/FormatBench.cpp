@@ -0,0 +1,132 @@
+// Host benchmark of ParallaxLCDBuffer number formatting against Print
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// Times printNumber() and printFixed() against Print::print(long) and
+// Print::print(double) over the same values, and checks that both give
+// the same text. Build from this directory with:
+//
+//   g++ -O2 -I. -I.. -o FormatBench FormatBench.cpp ../ParallaxLCD.cpp ../ParallaxLCDBuffer.cpp
+//
+// The host has a hardware FPU and divider, so the gap here is far smaller
+// than on the AVR, where both are done in software. Treat the ratios as a
+// lower bound.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Arduino.h"
+#include "ParallaxLCD.h"
+#include "ParallaxLCDBuffer.h"
+
+#define BENCH_WIDTH     (8)
+#define BENCH_ROUNDS    (20)
+#define BENCH_LOW       (-999999L)
+#define BENCH_HIGH      (999999L)
+#define BENCH_STEP      (7)
+
+// Collects printed text so it can be compared with the buffer cells.
+class TextSink : public Print {
+public:
+    char text[24];
+    uint8_t length;
+    virtual size_t write(uint8_t value) {
+        if (this->length < sizeof(this->text) - 1) {
+            this->text[this->length++] = value;
+        }
+        return 1;
+    }
+    using Print::write;
+};
+
+static volatile unsigned long sink;
+
+static double seconds(clock_t start) {
+    return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+// Compare a right aligned field of the buffer with printed text.
+static bool same(ParallaxLCDBuffer& buffer, const char* text, uint8_t length) {
+    if (length > BENCH_WIDTH) {
+        return false;
+    }
+    for (uint8_t i=0; i < BENCH_WIDTH; i++) {
+        char expected = i < BENCH_WIDTH - length ? ' ' : text[i - (BENCH_WIDTH - length)];
+        if (buffer.cell(0, i) != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void report(const char* name, double buffer, double print, unsigned long mismatches) {
+    printf("%-10s buffer %7.3fs  print %7.3fs  %5.2fx  %lu mismatches\n",
+        name, buffer, print, print / buffer, mismatches);
+}
+
+int main() {
+    ParallaxLCD lcd(2, 9600);
+    ParallaxLCDBuffer buffer(lcd);
+    TextSink text;
+    unsigned long mismatches;
+    clock_t start;
+    double bufferTime;
+    double printTime;
+
+    // Check the output first, then time each side on its own.
+    mismatches = 0;
+    for (long v=BENCH_LOW; v <= BENCH_HIGH; v += BENCH_STEP) {
+        buffer.printNumber(0, 0, BENCH_WIDTH, v);
+        text.length = 0;
+        text.print(v);
+        mismatches += !same(buffer, text.text, text.length);
+    }
+    start = clock();
+    for (int r=0; r < BENCH_ROUNDS; r++) {
+        for (long v=BENCH_LOW; v <= BENCH_HIGH; v += BENCH_STEP) {
+            buffer.printNumber(0, 0, BENCH_WIDTH, v);
+            sink += buffer.cell(0, BENCH_WIDTH - 1);
+        }
+    }
+    bufferTime = seconds(start);
+    start = clock();
+    for (int r=0; r < BENCH_ROUNDS; r++) {
+        for (long v=BENCH_LOW; v <= BENCH_HIGH; v += BENCH_STEP) {
+            text.length = 0;
+            text.print(v);
+            sink += text.length;
+        }
+    }
+    printTime = seconds(start);
+    report("integer", bufferTime, printTime, mismatches);
+
+    // Two decimals: printFixed() on hundredths against print(float, 2).
+    mismatches = 0;
+    for (long v=BENCH_LOW; v <= BENCH_HIGH; v += BENCH_STEP) {
+        buffer.printFixed(0, 0, BENCH_WIDTH, v, 2);
+        text.length = 0;
+        text.print((float) v / 100, 2);
+        mismatches += !same(buffer, text.text, text.length);
+    }
+    start = clock();
+    for (int r=0; r < BENCH_ROUNDS; r++) {
+        for (long v=BENCH_LOW; v <= BENCH_HIGH; v += BENCH_STEP) {
+            buffer.printFixed(0, 0, BENCH_WIDTH, v, 2);
+            sink += buffer.cell(0, BENCH_WIDTH - 1);
+        }
+    }
+    bufferTime = seconds(start);
+    start = clock();
+    for (int r=0; r < BENCH_ROUNDS; r++) {
+        for (long v=BENCH_LOW; v <= BENCH_HIGH; v += BENCH_STEP) {
+            text.length = 0;
+            text.print((float) v / 100, 2);
+            sink += text.length;
+        }
+    }
+    printTime = seconds(start);
+    report("fixed", bufferTime, printTime, mismatches);
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+// Host stand-in for SoftwareSerial that counts and discards output
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef SoftwareSerial_h
+#define SoftwareSerial_h
+
+#include "Arduino.h"
+
+class SoftwareSerial : public Stream {
+public:
+    SoftwareSerial(uint8_t receivePin, uint8_t transmitPin, bool inverse = false) {
+        this->sent = 0;
+    }
+    void begin(long speed) {}
+    bool stopListening() { return true; }
+    virtual size_t write(uint8_t value) {
+        this->sent++;
+        return 1;
+    }
+    using Print::write;
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+    virtual int peek() { return -1; }
+    unsigned long sent;
+};
+
+#endif
@@ -6,6 +6,13 @@
 #include "Arduino.h"
 #include "ParallaxPing.h"
 
+#ifdef DRIVER_STATS
+#include <DriverProbe.h>
+#else
+#define DRIVER_PROBE_START()
+#define DRIVER_PROBE_END(probe, miss)
+#endif
+
 /**
  * Constructor. Sets delay to enough microseconds to comfortably 
  * cover 20' or 6m. (Round trip of full range of 10' or 3m) 
@@ -15,8 +22,7 @@
  * @param pin Signal line
  */
 ParallaxPing::ParallaxPing(int pin) {
-    this->_pin = pin;
-    this->_delay = 200000;
+    this->init(pin, 200000);
 }
 
 /**
@@ -28,8 +34,7 @@ ParallaxPing::ParallaxPing(int pin) {
  * @param delay Maximum delay to wait for the sensor pulse.
  */
 ParallaxPing::ParallaxPing(int pin, long delay) {
-    this->_pin = pin;
-    this->_delay = delay;
+    this->init(pin, delay);
 }
 
 /**
@@ -38,10 +43,24 @@ ParallaxPing::ParallaxPing(int pin, long delay) {
  * @author nedwidek (2012/07/01)
  * 
  * @return The raw range in microseconds. Useful when 
- *         adjustments need to be made.
+ *         adjustments need to be made. In adaptive mode a
+ *         missed echo returns OUT_OF_RANGE, which makes the
+ *         scaled ranges below negative.
  */
 long ParallaxPing::rangeRaw() {
-    return this->ping() / 2;
+    long echo = this->ping();
+
+    if (this->_adaptive) {
+        if (echo == 0) {
+            // The target may have left the narrowed window. Forget the
+            // history so the next ping listens over the full range again.
+            this->_historyCount = 0;
+            return OUT_OF_RANGE;
+        }
+        this->remember(echo);
+    }
+
+    return echo / 2;
 }
 
 /**
@@ -100,10 +119,98 @@ void ParallaxPing::setPin(int pin) {
     this->_pin = pin;
 }
 
+/**
+ * Set the maximum time to wait for the sensor pulse when not in 
+ * adaptive mode. 
+ * 
+ * @author nedwidek (2012/07/01)
+ * 
+ * @param delay Maximum delay in microseconds.
+ */
 void ParallaxPing::setDelay(long delay) {
     this->_delay = delay;
 }
 
+/**
+ * Set the maximum range of interest and switch to adaptive 
+ * mode. Echoes from beyond this range are reported as 
+ * OUT_OF_RANGE instead of being waited for. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param mm The furthest range, in millimeters, that is of 
+ *           interest.
+ */
+void ParallaxPing::setMaxRange(long mm) {
+    this->_maxTimeout = PING_HOLDOFF_US + mm * PING_ROUNDTRIP_MM / 100;
+    this->_historyCount = 0;
+    this->_adaptive = true;
+}
+
+/**
+ * Turn adaptive mode on or off. In adaptive mode the echo 
+ * timeout is sized from the maximum range (see setMaxRange) 
+ * and the most recent echoes, and misses are reported as 
+ * OUT_OF_RANGE. With adaptive mode off the fixed delay is 
+ * used and misses read as zero. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param adaptive true to enable adaptive mode.
+ */
+void ParallaxPing::setAdaptive(bool adaptive) {
+    this->_historyCount = 0;
+    this->_adaptive = adaptive;
+}
+
+/**
+ * Gets the timeout that will be used for the next ping. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The time in microseconds to wait for the echo.
+ */
+long ParallaxPing::timeout() {
+    if (!this->_adaptive) {
+        return this->_delay;
+    }
+    if (this->_historyCount == 0) {
+        return this->_maxTimeout;
+    }
+
+    long recent = 0;
+    for (uint8_t i=0; i < this->_historyCount; i++) {
+        if (this->_history[i] > recent) {
+            recent = this->_history[i];
+        }
+    }
+
+    // Leave room for the target to move away by half its range again.
+    long window = PING_HOLDOFF_US + recent + recent / 2 + PING_ADAPT_SLACK_US;
+    if (window > this->_maxTimeout) {
+        window = this->_maxTimeout;
+    }
+
+    return window;
+}
+
+void ParallaxPing::init(int pin, long delay) {
+    this->_pin = pin;
+    this->_delay = delay;
+    this->_adaptive = false;
+    this->_maxTimeout = delay;
+    this->_historyIndex = 0;
+    this->_historyCount = 0;
+}
+
+void ParallaxPing::remember(long echo) {
+    this->_history[this->_historyIndex] = echo > 0xFFFF ? 0xFFFF : echo;
+    this->_historyIndex = (this->_historyIndex + 1) % PING_HISTORY;
+    if (this->_historyCount < PING_HISTORY) {
+        this->_historyCount++;
+    }
+}
+
 /**
  * Make a measurement with the sensor.
  * 
@@ -112,6 +219,8 @@ void ParallaxPing::setDelay(long delay) {
  * @return The round trip time for the ultrasonic chirp in ms. 
  */
 long ParallaxPing::ping() {
+    DRIVER_PROBE_START();
+
     // Tell the sensor we want a reading
     pinMode(_pin, OUTPUT);
     digitalWrite(_pin, LOW);
@@ -122,5 +231,7 @@ long ParallaxPing::ping() {
 
     // Sensor sends back a pulse whose width is the roundtrip time for the ping. We return the pulse width, which is in ms.
     pinMode(_pin, INPUT);
-    return pulseIn(_pin, HIGH, _delay);
+    long echo = pulseIn(_pin, HIGH, this->timeout());
+    DRIVER_PROBE_END(DRIVER_PING, echo == 0);
+    return echo;
 }
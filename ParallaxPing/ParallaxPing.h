@@ -8,6 +8,15 @@
 
 #include "Arduino.h"
 
+// Time from trigger until the sensor raises the echo line (tHOLDOFF).
+#define PING_HOLDOFF_US     (750)
+// Round trip time of the chirp per millimeter of range, in 1/100 us.
+#define PING_ROUNDTRIP_MM   (583)
+// Slack added to the adaptive window so a target drifting away is not lost.
+#define PING_ADAPT_SLACK_US (600)
+// Number of recent echoes the adaptive timeout is sized from.
+#define PING_HISTORY        (4)
+
 class ParallaxPing {
 public:
     ParallaxPing(int pin);
@@ -19,9 +28,21 @@ public:
     float rangeFeet();
     void setPin(int pin);
     void setDelay(long delay);
+    void setMaxRange(long mm);
+    void setAdaptive(bool adaptive);
+    long timeout();
+
+    static const long OUT_OF_RANGE = -1;
 private:
     int _pin;
     long _delay;
+    bool _adaptive;
+    long _maxTimeout;
+    unsigned int _history[PING_HISTORY];
+    uint8_t _historyIndex;
+    uint8_t _historyCount;
+    void init(int pin, long delay);
+    void remember(long echo);
     long ping();
 };
 
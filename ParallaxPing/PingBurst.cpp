@@ -0,0 +1,197 @@
+// Maximum rate repeated ranging for the Parallax Ping))) sensor
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include "PingBurst.h"
+
+/**
+ * Constructor. The sensor's own settings (fixed delay or 
+ * adaptive window) decide how long each ping listens. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param sensor The sensor to ping.
+ */
+PingBurst::PingBurst(ParallaxPing& sensor) {
+    this->_sensor = &sensor;
+    this->_running = false;
+    this->_decay = PING_DECAY_US;
+    this->_head = 0;
+    this->_count = 0;
+    this->_misses = 0;
+    this->_dropped = 0;
+    this->_interval = PING_HOLDOFF_US + PING_MAX_ECHO_US + PING_REARM_US;
+}
+
+/**
+ * Start pinging. The first ping goes out on the next poll().
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void PingBurst::start() {
+    this->_running = true;
+    this->_next = micros();
+    this->_interval = PING_HOLDOFF_US + PING_MAX_ECHO_US + PING_REARM_US;
+}
+
+/**
+ * Stop pinging. Samples not yet read are kept.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void PingBurst::stop() {
+    this->_running = false;
+}
+
+/**
+ * Checks if the burst is running.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return true between start() and stop().
+ */
+bool PingBurst::running() {
+    return this->_running;
+}
+
+/**
+ * Set the time allowed after an echo for the chirp to stop 
+ * ringing off the target and nearby surfaces. Raise it if 
+ * ranges jump about in a reverberant space. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param us The decay time in microseconds.
+ */
+void PingBurst::setDecay(unsigned int us) {
+    this->_decay = us;
+}
+
+/**
+ * Ping if it is safe to, and store the range. Call from loop() 
+ * as often as possible; between pings this only checks the 
+ * time. The ping itself blocks until the echo returns or the 
+ * sensor's timeout passes. 
+ * 
+ * The next ping is allowed once the last echo has had time to 
+ * bounce off the target a second time and die away: the 
+ * holdoff, twice the round trip and the decay time from the 
+ * last trigger. A target at 30cm can be ranged about 190 times 
+ * a second this way. After a miss the sensor may still be 
+ * listening, so the full echo time is waited out. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return true if a range was stored.
+ */
+bool PingBurst::poll() {
+    if (!this->_running) {
+        return false;
+    }
+
+    unsigned long now = micros();
+    if ((long) (now - this->_next) < 0) {
+        return false;
+    }
+
+    long echo = this->_sensor->rangeRaw();
+
+    if (echo <= 0) {
+        this->_interval = PING_HOLDOFF_US + PING_MAX_ECHO_US + PING_REARM_US;
+        this->_next = now + this->_interval;
+        this->_misses++;
+        return false;
+    }
+
+    // echo is one way, so a second bounce ends 4 * echo after holdoff.
+    // The sensor also needs its rearm time after the first echo ends.
+    unsigned long minimum = PING_HOLDOFF_US + 2 * echo + PING_REARM_US;
+    this->_interval = PING_HOLDOFF_US + 4 * echo + this->_decay;
+    if (this->_interval < minimum) {
+        this->_interval = minimum;
+    }
+    this->_next = now + this->_interval;
+
+    // A full ring loses its oldest sample.
+    if (this->_count == PING_BURST_SAMPLES) {
+        this->_head = (this->_head + 1) % PING_BURST_SAMPLES;
+        this->_count--;
+        this->_dropped++;
+    }
+
+    PingSample& sample = this->_samples[(this->_head + this->_count) % PING_BURST_SAMPLES];
+    sample.time = now + PING_HOLDOFF_US + echo;
+    sample.echo = echo;
+    sample.mm = echo * 200 / PING_ROUNDTRIP_MM;
+    this->_count++;
+    return true;
+}
+
+/**
+ * Gets the time between the last ping and the next, which sets 
+ * the current ranging rate. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The interval in microseconds.
+ */
+unsigned long PingBurst::interval() {
+    return this->_interval;
+}
+
+/**
+ * Gets the number of samples waiting to be read.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The sample count.
+ */
+uint8_t PingBurst::available() {
+    return this->_count;
+}
+
+/**
+ * Take the oldest waiting sample.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param sample Receives the sample.
+ * @return false if there was none.
+ */
+bool PingBurst::read(PingSample& sample) {
+    if (this->_count == 0) {
+        return false;
+    }
+
+    sample = this->_samples[this->_head];
+    this->_head = (this->_head + 1) % PING_BURST_SAMPLES;
+    this->_count--;
+    return true;
+}
+
+/**
+ * Gets the number of pings that got no echo.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The miss count.
+ */
+unsigned long PingBurst::misses() {
+    return this->_misses;
+}
+
+/**
+ * Gets the number of samples lost because they were not read 
+ * before the ring filled. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The drop count.
+ */
+unsigned long PingBurst::dropped() {
+    return this->_dropped;
+}
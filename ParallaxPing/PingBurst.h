@@ -0,0 +1,57 @@
+// Maximum rate repeated ranging for the Parallax Ping))) sensor
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef PingBurst_h
+#define PingBurst_h
+
+#include "Arduino.h"
+#include "ParallaxPing.h"
+
+// Longest echo pulse the sensor gives when nothing answers (tOUT max).
+#define PING_MAX_ECHO_US    (18500)
+// Time the sensor needs between the end of one echo and the next trigger.
+#define PING_REARM_US       (200)
+// Default time allowed for ringing to die down after the echo returns.
+#define PING_DECAY_US       (1000)
+// Samples kept until read.
+#ifndef PING_BURST_SAMPLES
+#define PING_BURST_SAMPLES  (8)
+#endif
+
+// One range from a burst.
+struct PingSample {
+    unsigned long time;     // micros() when the chirp reached the target
+    long echo;              // one way echo time in us, as rangeRaw()
+    long mm;                // range in mm at 20C
+};
+
+// See .cpp source for method documentation.
+class PingBurst {
+public:
+    PingBurst(ParallaxPing& sensor);
+    void start();
+    void stop();
+    bool running();
+    void setDecay(unsigned int us);
+    bool poll();
+    unsigned long interval();
+    uint8_t available();
+    bool read(PingSample& sample);
+    unsigned long misses();
+    unsigned long dropped();
+private:
+    ParallaxPing* _sensor;
+    bool _running;
+    unsigned int _decay;
+    unsigned long _interval;
+    unsigned long _next;
+    unsigned long _misses;
+    unsigned long _dropped;
+    PingSample _samples[PING_BURST_SAMPLES];
+    uint8_t _head;
+    uint8_t _count;
+};
+
+#endif
@@ -0,0 +1,181 @@
+// Filtered, temperature compensated ranging for the Parallax Ping))) sensor
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include "PingRanger.h"
+
+/**
+ * Constructor. Assumes an air temperature of 20C and no 
+ * tracking until told otherwise. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param sensor The sensor to take pings from.
+ */
+PingRanger::PingRanger(ParallaxPing& sensor) {
+    this->_sensor = &sensor;
+    this->_alpha = 0;
+    this->_beta = 0;
+    this->setTemperature(200);
+    this->reset();
+}
+
+/**
+ * Set the air temperature used to correct the speed of sound. 
+ * A TMP36 can supply this with temperatureDeciC(). 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param deciC The air temperature in tenths of a degree C.
+ */
+void PingRanger::setTemperature(int deciC) {
+    this->_soundSpeed = PING_SOUND_0C + (long) deciC * PING_SOUND_PER_C / 10;
+}
+
+/**
+ * Enable the alpha-beta tracker on the median filtered ranges. 
+ * Gains are fractions of 256; an alpha of 0 turns tracking off 
+ * and the median is returned as is. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param alpha Position gain, 0 - 255.
+ * @param beta Velocity gain, 0 - 255.
+ */
+void PingRanger::setTracking(uint8_t alpha, uint8_t beta) {
+    this->_alpha = alpha;
+    this->_beta = beta;
+    this->_tracking = false;
+}
+
+/**
+ * Forget all previous ranges.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void PingRanger::reset() {
+    this->_index = 0;
+    this->_count = 0;
+    this->_tracking = false;
+    this->_velocity = 0;
+    this->_output = ParallaxPing::OUT_OF_RANGE;
+}
+
+/**
+ * Ping the sensor and run the result through the pipeline.
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The filtered range in millimeters, or OUT_OF_RANGE 
+ *         if the ping was missed.
+ */
+long PingRanger::update() {
+    return this->update(this->_sensor->rangeRaw(), millis());
+}
+
+/**
+ * Run a one way echo time through the pipeline. Useful when 
+ * the pings are taken elsewhere. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @param echo The one way echo time in microseconds as 
+ *             returned by ParallaxPing::rangeRaw().
+ * @param now The time of the ping in milliseconds.
+ * @return The filtered range in millimeters, or OUT_OF_RANGE 
+ *         if the ping was missed. A miss leaves the filter
+ *         state untouched.
+ */
+long PingRanger::update(long echo, unsigned long now) {
+    if (echo <= 0) {
+        return ParallaxPing::OUT_OF_RANGE;
+    }
+
+    this->_window[this->_index] = (echo * this->_soundSpeed + 5000) / 10000;
+    this->_index = (this->_index + 1) % PING_MEDIAN_WINDOW;
+    if (this->_count < PING_MEDIAN_WINDOW) {
+        this->_count++;
+    }
+
+    long measured = this->median();
+    if (this->_alpha == 0) {
+        this->_output = measured;
+        return this->_output;
+    }
+
+    // Position and velocity are kept in 16.16 fixed point, mm and mm/ms.
+    if (!this->_tracking) {
+        this->_position = measured << 16;
+        this->_velocity = 0;
+        this->_last = now;
+        this->_tracking = true;
+        this->_output = measured;
+        return this->_output;
+    }
+
+    long dt = now - this->_last;
+    if (dt < 1) {
+        dt = 1;
+    } else if (dt > 1000) {
+        dt = 1000;
+    }
+    this->_last = now;
+
+    long predicted = this->_position + this->_velocity * dt;
+    long residual = ((measured << 16) - predicted) >> 8;
+
+    this->_position = predicted + residual * this->_alpha;
+    this->_velocity += residual * this->_beta / dt;
+    if (this->_velocity > ((long) PING_MAX_VELOCITY << 16)) {
+        this->_velocity = (long) PING_MAX_VELOCITY << 16;
+    } else if (this->_velocity < -((long) PING_MAX_VELOCITY << 16)) {
+        this->_velocity = -((long) PING_MAX_VELOCITY << 16);
+    }
+
+    this->_output = (this->_position + 0x8000) >> 16;
+    return this->_output;
+}
+
+/**
+ * Gets the last range produced by update().
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The range in millimeters, or OUT_OF_RANGE if there 
+ *         has been no good ping yet.
+ */
+long PingRanger::millimeters() {
+    return this->_output;
+}
+
+/**
+ * Gets the velocity estimated by the tracker. Positive values 
+ * are moving away from the sensor. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The velocity in mm/s, zero when not tracking.
+ */
+long PingRanger::velocity() {
+    return ((this->_velocity >> 6) * 1000) >> 10;
+}
+
+long PingRanger::median() {
+    long sorted[PING_MEDIAN_WINDOW];
+
+    // Insertion sort; the window is only a handful of entries.
+    for (uint8_t i=0; i < this->_count; i++) {
+        long value = this->_window[i];
+        uint8_t j = i;
+        while (j > 0 && sorted[j-1] > value) {
+            sorted[j] = sorted[j-1];
+            j--;
+        }
+        sorted[j] = value;
+    }
+
+    return sorted[this->_count / 2];
+}
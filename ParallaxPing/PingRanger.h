@@ -0,0 +1,47 @@
+// Filtered, temperature compensated ranging for the Parallax Ping))) sensor
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef PingRanger_h
+#define PingRanger_h
+
+#include "Arduino.h"
+#include "ParallaxPing.h"
+
+// Number of recent ranges the median filter is taken over.
+#define PING_MEDIAN_WINDOW  (5)
+// Speed of sound in dry air at 0C, in dm/s, and its change per degree C.
+#define PING_SOUND_0C       (3313)
+#define PING_SOUND_PER_C    (6)
+// Tracker velocity limit in mm/ms (m/s). Keeps the fixed point math in range.
+#define PING_MAX_VELOCITY   (20)
+
+// See .cpp source for method documentation.
+class PingRanger {
+public:
+    PingRanger(ParallaxPing& sensor);
+    void setTemperature(int deciC);
+    void setTracking(uint8_t alpha, uint8_t beta);
+    void reset();
+    long update();
+    long update(long echo, unsigned long now);
+    long millimeters();
+    long velocity();
+private:
+    ParallaxPing* _sensor;
+    int _soundSpeed;
+    long _window[PING_MEDIAN_WINDOW];
+    uint8_t _index;
+    uint8_t _count;
+    uint8_t _alpha;
+    uint8_t _beta;
+    bool _tracking;
+    long _position;
+    long _velocity;
+    unsigned long _last;
+    long _output;
+    long median();
+};
+
+#endif
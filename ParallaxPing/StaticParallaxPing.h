@@ -0,0 +1,42 @@
+// Compile time configured Parallax Ping))) Ultrasonic Sensor (#28015-RT)
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef StaticParallaxPing_h
+#define StaticParallaxPing_h
+
+#include "Arduino.h"
+#include "ParallaxPing.h"
+
+// Ping))) with the pin and echo timeout fixed at compile time. All
+// methods are static, so it takes no RAM at all:
+//   typedef StaticParallaxPing<7, 12000> Front;
+//   long mm = Front::rangeMillimeters();
+template <uint8_t PIN, unsigned long TIMEOUT = 200000UL>
+class StaticParallaxPing {
+public:
+    static long ping() {
+        pinMode(PIN, OUTPUT);
+        digitalWrite(PIN, LOW);
+        delayMicroseconds(2);
+        digitalWrite(PIN, HIGH);
+        delayMicroseconds(5);
+        digitalWrite(PIN, LOW);
+
+        pinMode(PIN, INPUT);
+        return pulseIn(PIN, HIGH, TIMEOUT);
+    }
+    // One way echo time in microseconds, OUT_OF_RANGE on a miss.
+    static long rangeRaw() {
+        long echo = ping();
+        return echo == 0 ? ParallaxPing::OUT_OF_RANGE : echo / 2;
+    }
+    // Range in millimeters at 20C, OUT_OF_RANGE on a miss.
+    static long rangeMillimeters() {
+        long echo = rangeRaw();
+        return echo < 0 ? echo : (echo * 3433 + 5000) / 10000;
+    }
+};
+
+#endif
@@ -6,79 +6,191 @@
 #include "Arduino.h"
 #include "RS2760249.h"
 
+// The constructors that take a bit of the analog port use this limit.
 #if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
-#define PORT PORTF
-#define MAX_PIN 7
-#define STRIP_PINOUT DDRF
+#define RS2760249_MAX_PIN 7
 #else
-#define PORT PORTC
-#define MAX_PIN 5
-#define STRIP_PINOUT DDRC
+#define RS2760249_MAX_PIN 5
 #endif
 
-#define NOP "nop\n\t"
+#ifdef DRIVER_STATS
+#include <DriverProbe.h>
+#else
+#define DRIVER_PROBE_START()
+#define DRIVER_PROBE_END(probe, miss)
+#endif
+
+// The port and bit are looked up once, so a pulse is a single store to
+// a port register with the delay between stores counted in CPU cycles.
+// Off the AVR the stores and delays go to the simulator in host/.
+#ifdef __AVR__
+#define STRIP_DELAY(cycles) __builtin_avr_delay_cycles(cycles)
+#define STRIP_OUT(port, value) (*(port) = (value))
+#else
+#include "host/RS2760249Sim.h"
+#define STRIP_DELAY(cycles) rs2760249Delay(cycles)
+#define STRIP_OUT(port, value) rs2760249Out(port, value)
+#endif
 
+/**
+ * Constructor for a strip on a pin of the analog port, e.g. 0 
+ * for A0. 
+ *  
+ * @author nedwidek (2013/09/10)
+ *  
+ * @param pin The bit of the analog port, 0 - RS2760249_MAX_PIN.
+ * @param segments The number of segments on the strip.
+ */
 RS2760249::RS2760249(int pin, int segments) {
-    this->init(pin, segments);
+    this->init(pin <= RS2760249_MAX_PIN && pin >= 0 ? A0 + pin : -1, segments);
 }
 
+/**
+ * Constructor for a 10 segment strip on a pin of the analog 
+ * port. 
+ *  
+ * @author nedwidek (2013/09/10)
+ *  
+ * @param pin The bit of the analog port, 0 - RS2760249_MAX_PIN.
+ */
 RS2760249::RS2760249(int pin) {
-    this->init(pin, 10);
+    this->init(pin <= RS2760249_MAX_PIN && pin >= 0 ? A0 + pin : -1, 10);
+}
+
+RS2760249::RS2760249() {
+}
+
+/**
+ * Create a strip on any digital pin. The pin's port and bit are 
+ * found here, so send() runs just as fast as on the analog 
+ * port: 
+ *    RS2760249 strip = RS2760249::onPin(7);
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param pin The Arduino pin number.
+ * @param segments The number of segments on the strip.
+ * @return The strip. Check valid() if the pin may not exist.
+ */
+RS2760249 RS2760249::onPin(uint8_t pin, int segments) {
+    RS2760249 strip;
+    strip.init(pin, segments);
+    return strip;
+}
+
+/**
+ * Checks if the pin given at construction can drive a strip. 
+ * Nothing is sent on an invalid pin. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return true if the pin was found.
+ */
+bool RS2760249::valid() {
+    return this->port != 0;
 }
 
 void RS2760249::reset() {
-    //(PORT &= (0xFF ^ this->pin));
     delayMicroseconds(24);
 }
 
 void RS2760249::clear() {
     this->reset();
+    noInterrupts();
     for (int i=0; i<this->segments; i++) {
-        this->send(0x000000);
+        RS2760249::sendOn(this->port, this->pin, 0x000000);
     }
+    interrupts();
 }
 
 void RS2760249::send(uint32_t data) {
-    int i;
-    unsigned long j=0x000001;
-
-    for (i=0; i<24; i++) {
-        if (data & j) {
-            (PORT |= this->pin);
-            __asm__(NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP NOP);
-            (PORT &= (0xFF ^ this->pin));
+    noInterrupts();
+    RS2760249::sendOn(this->port, this->pin, data);
+    interrupts();
+}
+
+/**
+ * Gets the output register and bit for an Arduino pin. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param pin The Arduino pin number.
+ * @param mask Receives the pin's bit in the register.
+ * @return The output register, or 0 if the pin does not exist.
+ */
+volatile uint8_t* RS2760249::portOf(int pin, uint8_t& mask) {
+    mask = 0x00;
+#ifdef __AVR__
+    if (pin < 0 || pin >= NUM_DIGITAL_PINS || digitalPinToPort(pin) == NOT_A_PIN) {
+        return 0;
+    }
+    mask = digitalPinToBitMask(pin);
+    return portOutputRegister(digitalPinToPort(pin));
+#else
+    if (pin < 0 || pin >= RS2760249_SIM_PINS) {
+        return 0;
+    }
+    mask = 1 << (pin % 8);
+    return rs2760249Port(pin);
+#endif
+}
+
+/**
+ * Send one 24 bit word on a port bit. This holds the pulse 
+ * timing, so every strip, static or not, sends the same way. 
+ * Interrupts must be off while sending: the whole port is 
+ * stored from a copy taken at the start, so an interrupt that 
+ * changed another pin of the port would be undone. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param port The output register from portOf(), or 0 to send 
+ *             nothing.
+ * @param mask The pin's bit in the register.
+ * @param data The word, least significant bit first.
+ */
+void RS2760249::sendOn(volatile uint8_t* port, uint8_t mask, uint32_t data) {
+    if (port == 0) {
+        return;
+    }
+
+    // Only this pin changes; the rest of the port keeps its state.
+    uint8_t high = *port | mask;
+    uint8_t low = *port & ~mask;
+
+    for (uint8_t i=0; i<24; i++) {
+        if (data & 0x01) {
+            STRIP_OUT(port, high);
+            STRIP_DELAY(RS2760249_T1H_CYCLES);
+            STRIP_OUT(port, low);
         } else {
-            (PORT |= this->pin);
-            __asm__(NOP NOP NOP NOP NOP NOP NOP NOP NOP);
-            (PORT &= (0xFF ^ this->pin));
-            __asm__(NOP NOP NOP);
+            STRIP_OUT(port, high);
+            STRIP_DELAY(RS2760249_T0H_CYCLES);
+            STRIP_OUT(port, low);
+            STRIP_DELAY(RS2760249_T0L_CYCLES);
         }
-        j<<=1;
+        data >>= 1;
     }
 }
 
 void RS2760249::sendPattern(unsigned long data[], int length) {
+    DRIVER_PROBE_START();
     noInterrupts();
     for (int i=0; i<length; i++) {
         this->send(data[i]);
     }
     interrupts();
-
+    DRIVER_PROBE_END(DRIVER_STRIP_SEND, this->port == 0);
 }
 
 void RS2760249::init(int pin, int segments) {
-    // Inelegant. If they pass an invalid pin, we just won't work.
-    if (pin > MAX_PIN) {
-        this->pin = 0x00;
-    } else {
-        uint8_t pinmodes = 0x01;
-        pinmodes <<= pin;
-        this->pin = pinmodes;
-    }
-
     this->segments = segments;
+    this->port = RS2760249::portOf(pin, this->pin);
+    if (this->port == 0) {
+        return;
+    }
 
     // Set the pin to output.
-    (STRIP_PINOUT |= this->pin);
+    pinMode(pin, OUTPUT);
     this->reset();
 }
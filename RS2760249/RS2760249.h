@@ -8,19 +8,51 @@
 
 #include "Arduino.h"
 
+// Pulse widths in nanoseconds. A 1 bit is a long high pulse and a 0 bit
+// a short one. These are the widths of the original NOP sequences at
+// 16 MHz: 28 NOPs plus the two port stores high for a 1 bit (30 cycles),
+// 9 NOPs plus the stores high then 3 NOPs low for a 0 bit.
+#define RS2760249_T1H_NS (1875)
+#define RS2760249_T0H_NS (687)
+#define RS2760249_T0L_NS (187)
+// Cycles taken by the port store that starts or ends a pulse.
+#define RS2760249_STORE_CYCLES (2)
+
+#ifndef F_CPU
+#error "RS2760249 needs F_CPU for its pulse timing; pass -DF_CPU on host builds."
+#endif
+
+// Cycle budgets for the CPU clock, less the store already spent. Cycles
+// round up, so no pulse comes out shorter than its width.
+#define RS2760249_CYCLES(ns) (((uint32_t) (ns) * (F_CPU / 1000000UL) + 999) / 1000)
+#define RS2760249_BUDGET(ns) (RS2760249_CYCLES(ns) > RS2760249_STORE_CYCLES ? RS2760249_CYCLES(ns) - RS2760249_STORE_CYCLES : 0)
+#define RS2760249_T1H_CYCLES RS2760249_BUDGET(RS2760249_T1H_NS)
+#define RS2760249_T0H_CYCLES RS2760249_BUDGET(RS2760249_T0H_NS)
+#define RS2760249_T0L_CYCLES RS2760249_CYCLES(RS2760249_T0L_NS)
+
+#if F_CPU < 8000000UL
+#error "RS2760249 needs at least an 8 MHz clock to meet the 0 bit pulse width."
+#endif
+
+// See .cpp source for method documentation.
 class RS2760249 {
 public:
     RS2760249(int pin);
     RS2760249(int pin, int segments);
+    static RS2760249 onPin(uint8_t pin, int segments = 10);
+    static volatile uint8_t* portOf(int pin, uint8_t& mask);
+    static void sendOn(volatile uint8_t* port, uint8_t mask, uint32_t data);
+    bool valid();
     void reset();
     void send(uint32_t data);
     void sendPattern(unsigned long data[], int length);
     void clear();
 private:
+    volatile uint8_t* port;
     uint8_t pin;
     int segments;
+    RS2760249();
     void init(int pin, int segments);
 };
 
 #endif
-
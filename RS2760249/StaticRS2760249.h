@@ -0,0 +1,57 @@
+// Compile time configured RadioShack 1m LED Strip Model 2760249
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef StaticRS2760249_h
+#define StaticRS2760249_h
+
+#include "Arduino.h"
+#include "RS2760249.h"
+
+// LED strip with the pin and segment count fixed at compile time. All
+// methods are static, so it takes no RAM. The port is looked up from the
+// pin on each call and the bits go out through RS2760249::sendOn(), with
+// the same timing as an RS2760249:
+//   typedef StaticRS2760249<A2> Strip;
+//   Strip::begin();
+//   Strip::sendPattern(pattern, 10);
+template <uint8_t PIN, int SEGMENTS = 10>
+class StaticRS2760249 {
+public:
+    static void begin() {
+        pinMode(PIN, OUTPUT);
+        reset();
+    }
+    static void reset() {
+        delayMicroseconds(24);
+    }
+    static void send(uint32_t data) {
+        uint8_t mask;
+        volatile uint8_t* port = RS2760249::portOf(PIN, mask);
+        noInterrupts();
+        RS2760249::sendOn(port, mask, data);
+        interrupts();
+    }
+    static void sendPattern(const unsigned long data[], int length) {
+        uint8_t mask;
+        volatile uint8_t* port = RS2760249::portOf(PIN, mask);
+        noInterrupts();
+        for (int i=0; i < length; i++) {
+            RS2760249::sendOn(port, mask, data[i]);
+        }
+        interrupts();
+    }
+    static void clear() {
+        uint8_t mask;
+        volatile uint8_t* port = RS2760249::portOf(PIN, mask);
+        reset();
+        noInterrupts();
+        for (int i=0; i < SEGMENTS; i++) {
+            RS2760249::sendOn(port, mask, 0x000000);
+        }
+        interrupts();
+    }
+};
+
+#endif
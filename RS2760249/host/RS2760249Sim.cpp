@@ -0,0 +1,200 @@
+// Host simulation of the RS2760249 output for testing without a strip
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// Build RS2760249.cpp for the host with an Arduino.h stand-in and F_CPU
+// given on the command line (see SimCheck.cpp), and link this file.
+// Every port store and cycle delay lands here, on a cycle counter at
+// F_CPU, so the pulse widths chosen for the clock can be checked against
+// what the strip accepts.
+
+#include "RS2760249Sim.h"
+#include "../RS2760249.h"
+
+static volatile uint8_t ports[RS2760249_SIM_PINS / 8];
+static unsigned long cycles = 0;
+static RS2760249Sim* watcher = 0;
+
+static unsigned long toNs(unsigned long count) {
+    return count * 1000 / (F_CPU / 1000000UL);
+}
+
+volatile uint8_t* rs2760249Port(uint8_t pin) {
+    return &ports[pin / 8];
+}
+
+void rs2760249Out(volatile uint8_t* port, uint8_t value) {
+    cycles += RS2760249_STORE_CYCLES;
+    uint8_t changed = *port ^ value;
+    *port = value;
+    if (watcher != 0) {
+        watcher->edge((changed & value) != 0, cycles);
+    }
+    if ((value & changed) == 0) {
+        cycles += RS2760249_SIM_LOOP_CYCLES;
+    }
+}
+
+void rs2760249Delay(uint32_t count) {
+    cycles += count;
+}
+
+/**
+ * Constructor. Starts watching a pin; only one pin is watched 
+ * at a time. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param pin The pin the strip was created on, as passed to 
+ *            RS2760249::onPin().
+ */
+RS2760249Sim::RS2760249Sim(uint8_t pin) {
+    this->_port = rs2760249Port(pin);
+    this->_mask = 1 << (pin % 8);
+    this->_high = false;
+    this->reset();
+    watcher = this;
+}
+
+RS2760249Sim::~RS2760249Sim() {
+    if (watcher == this) {
+        watcher = 0;
+    }
+}
+
+/**
+ * Forget everything decoded so far.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void RS2760249Sim::reset() {
+    this->_bits = 0;
+    this->_errors = 0;
+    this->_word = 0;
+    for (uint8_t i=0; i < 2; i++) {
+        this->_shortest[i] = 0xFFFFFFFFUL;
+        this->_longest[i] = 0;
+    }
+}
+
+/**
+ * Gets the number of bits decoded.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The bit count.
+ */
+unsigned long RS2760249Sim::bits() {
+    return this->_bits;
+}
+
+/**
+ * Gets the number of high pulses the strip would not accept as 
+ * either a 0 or a 1. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The error count.
+ */
+unsigned long RS2760249Sim::errors() {
+    return this->_errors;
+}
+
+/**
+ * Gets the 24 bit words decoded, in the order sent.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param out Receives the words.
+ * @param count The most words to return; only the first 32 are
+ *              kept.
+ * @return The number of words returned.
+ */
+int RS2760249Sim::words(uint32_t out[], int count) {
+    int found = this->_bits / 24;
+    if (found > 32) {
+        found = 32;
+    }
+    if (found > count) {
+        found = count;
+    }
+    for (int i=0; i < found; i++) {
+        out[i] = this->_words[i];
+    }
+    return found;
+}
+
+/**
+ * Gets the shortest high pulse seen for a bit value.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param one true for 1 bits.
+ * @return The pulse width in nanoseconds.
+ */
+unsigned long RS2760249Sim::shortestNs(bool one) {
+    return toNs(this->_shortest[one ? 1 : 0]);
+}
+
+/**
+ * Gets the longest high pulse seen for a bit value.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param one true for 1 bits.
+ * @return The pulse width in nanoseconds.
+ */
+unsigned long RS2760249Sim::longestNs(bool one) {
+    return toNs(this->_longest[one ? 1 : 0]);
+}
+
+/**
+ * Record a change of the watched pin. Called from 
+ * rs2760249Out(). 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param high The new level.
+ * @param now The cycle count of the change.
+ */
+void RS2760249Sim::edge(bool high, unsigned long now) {
+    if (high == this->_high || (*this->_port & this->_mask) != (high ? this->_mask : 0)) {
+        return;
+    }
+    this->_high = high;
+    if (high) {
+        this->_rose = now;
+        return;
+    }
+
+    unsigned long width = now - this->_rose;
+    unsigned long ns = toNs(width);
+    int bit;
+    if (ns >= RS2760249_SIM_T0H_MIN && ns <= RS2760249_SIM_T0H_MAX) {
+        bit = 0;
+    } else if (ns >= RS2760249_SIM_T1H_MIN && ns <= RS2760249_SIM_T1H_MAX) {
+        bit = 1;
+    } else {
+        this->_errors++;
+        return;
+    }
+
+    if (width < this->_shortest[bit]) {
+        this->_shortest[bit] = width;
+    }
+    if (width > this->_longest[bit]) {
+        this->_longest[bit] = width;
+    }
+
+    // Bits go out least significant first.
+    this->_word |= (uint32_t) bit << (this->_bits % 24);
+    this->_bits++;
+    if (this->_bits % 24 == 0) {
+        if (this->_bits / 24 <= 32) {
+            this->_words[this->_bits / 24 - 1] = this->_word;
+        }
+        this->_word = 0;
+    }
+}
@@ -0,0 +1,58 @@
+// Host simulation of the RS2760249 output for testing without a strip
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef RS2760249Sim_h
+#define RS2760249Sim_h
+
+#include <stdint.h>
+
+// Simulated pins, eight to a port.
+#define RS2760249_SIM_PINS      (64)
+// Cycles the send() loop spends between bits besides the stores.
+#define RS2760249_SIM_LOOP_CYCLES (6)
+
+// What the strip accepts, in nanoseconds.
+#define RS2760249_SIM_T0H_MIN   (350)
+#define RS2760249_SIM_T0H_MAX   (1000)
+#define RS2760249_SIM_T1H_MIN   (1200)
+#define RS2760249_SIM_T1H_MAX   (2500)
+
+#ifndef A0
+#define A0 (14)
+#endif
+
+// Called by RS2760249.cpp in place of the port registers and delays.
+volatile uint8_t* rs2760249Port(uint8_t pin);
+void rs2760249Out(volatile uint8_t* port, uint8_t value);
+void rs2760249Delay(uint32_t cycles);
+
+// Watches one pin, times every high pulse in CPU cycles and decodes the
+// bits the strip would latch. A pulse outside both windows is an error.
+// See .cpp source for method documentation.
+class RS2760249Sim {
+public:
+    RS2760249Sim(uint8_t pin);
+    ~RS2760249Sim();
+    void reset();
+    unsigned long bits();
+    unsigned long errors();
+    int words(uint32_t out[], int count);
+    unsigned long shortestNs(bool one);
+    unsigned long longestNs(bool one);
+    void edge(bool high, unsigned long cycles);
+private:
+    volatile uint8_t* _port;
+    uint8_t _mask;
+    bool _high;
+    unsigned long _rose;
+    unsigned long _bits;
+    unsigned long _errors;
+    uint32_t _words[32];
+    uint32_t _word;
+    unsigned long _shortest[2];
+    unsigned long _longest[2];
+};
+
+#endif
@@ -0,0 +1,103 @@
+// Host check of the RS2760249 pulse widths against the strip's limits
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// Sends a pattern through RS2760249 and StaticRS2760249 on the simulator
+// and checks that every bit decodes, that both give the same widths, and
+// that at 16 MHz the widths are those of the original NOP sequences.
+// Build from this directory with:
+//
+//   g++ -DF_CPU=16000000UL -I../../I2CTrace/host -I.. \
+//       -o SimCheck SimCheck.cpp RS2760249Sim.cpp ../RS2760249.cpp
+//
+// Use -DF_CPU=8000000UL or another clock to check other boards. Exits
+// non-zero on a failure.
+
+#include <stdio.h>
+#include "Arduino.h"
+#include "RS2760249.h"
+#include "StaticRS2760249.h"
+#include "RS2760249Sim.h"
+
+#define CHECK_PIN       (7)
+#define CHECK_WORDS     (3)
+
+// Widths of the NOP sequences the strip was first driven with at 16 MHz.
+#define CHECK_16MHZ_T0H_NS  (687)
+#define CHECK_16MHZ_T1H_NS  (1875)
+
+// The driver only delays for a reset; the simulator keeps its own clock.
+static unsigned long elapsed = 0;
+
+unsigned long micros() {
+    return elapsed;
+}
+
+unsigned long millis() {
+    return elapsed / 1000;
+}
+
+void delay(unsigned long ms) {
+    elapsed += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+    elapsed += us;
+}
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// Checks one send and returns the 0 and 1 bit widths seen.
+static void verify(const char* name, RS2760249Sim& sim, const unsigned long pattern[], unsigned long widths[2]) {
+    uint32_t words[CHECK_WORDS];
+    int found = sim.words(words, CHECK_WORDS);
+
+    printf("%-16s bits %lu errors %lu  0: %lu-%lu ns  1: %lu-%lu ns\n", name, sim.bits(), sim.errors(),
+           sim.shortestNs(false), sim.longestNs(false), sim.shortestNs(true), sim.longestNs(true));
+
+    check(sim.errors() == 0, "every pulse is a valid 0 or 1");
+    check(found == CHECK_WORDS, "every word decodes");
+    for (int i=0; i < found; i++) {
+        check(words[i] == (pattern[i] & 0xFFFFFF), "words decode as sent");
+    }
+    check(sim.shortestNs(false) == sim.longestNs(false), "0 bits all the same width");
+    check(sim.shortestNs(true) == sim.longestNs(true), "1 bits all the same width");
+    widths[0] = sim.shortestNs(false);
+    widths[1] = sim.shortestNs(true);
+}
+
+int main() {
+    unsigned long pattern[CHECK_WORDS] = { 0x123456, 0xABCDEF, 0x000001 };
+    unsigned long plain[2];
+    unsigned long fixed[2];
+
+    printf("F_CPU %lu Hz\n", (unsigned long) F_CPU);
+
+    RS2760249Sim sim(CHECK_PIN);
+    RS2760249 strip = RS2760249::onPin(CHECK_PIN, CHECK_WORDS);
+    check(strip.valid(), "strip pin found");
+    strip.sendPattern(pattern, CHECK_WORDS);
+    verify("RS2760249", sim, pattern, plain);
+
+    sim.reset();
+    StaticRS2760249<CHECK_PIN, CHECK_WORDS>::begin();
+    StaticRS2760249<CHECK_PIN, CHECK_WORDS>::sendPattern(pattern, CHECK_WORDS);
+    verify("StaticRS2760249", sim, pattern, fixed);
+
+    check(plain[0] == fixed[0] && plain[1] == fixed[1], "both variants give the same widths");
+    if (F_CPU == 16000000UL) {
+        check(plain[0] == CHECK_16MHZ_T0H_NS, "0 bit matches the NOP timing at 16 MHz");
+        check(plain[1] == CHECK_16MHZ_T1H_NS, "1 bit matches the NOP timing at 16 MHz");
+    }
+
+    printf(failures == 0 ? "OK\n" : "%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
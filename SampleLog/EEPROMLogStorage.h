@@ -0,0 +1,45 @@
+// EEPROM storage for the SampleLog
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef EEPROMLogStorage_h
+#define EEPROMLogStorage_h
+
+#include "Arduino.h"
+#include <EEPROM.h>
+#include "LogStorage.h"
+#ifdef __AVR__
+#include <avr/eeprom.h>
+#endif
+
+// A range of the on-chip EEPROM. Bytes that already hold the value are
+// not rewritten, saving wear.
+class EEPROMLogStorage : public LogStorage {
+public:
+    EEPROMLogStorage(uint16_t start, uint16_t size) {
+        this->_start = start;
+        this->_size = size;
+    }
+    virtual uint16_t size() {
+        return this->_size;
+    }
+    virtual uint8_t read(uint16_t address) {
+        return EEPROM.read(this->_start + address);
+    }
+    virtual bool busy() {
+#ifdef __AVR__
+        return !eeprom_is_ready();
+#else
+        return false;
+#endif
+    }
+    virtual void write(uint16_t address, uint8_t value) {
+        EEPROM.update(this->_start + address, value);
+    }
+private:
+    uint16_t _start;
+    uint16_t _size;
+};
+
+#endif
@@ -0,0 +1,23 @@
+// Byte storage behind the SampleLog
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef LogStorage_h
+#define LogStorage_h
+
+#include <stdint.h>
+
+// Storage for SampleLog. Writes are started one byte at a time and may
+// complete in the background (as EEPROM writes do); the log only starts a
+// write once busy() is false, so it never waits on the storage.
+class LogStorage {
+public:
+    virtual ~LogStorage() {}
+    virtual uint16_t size() = 0;
+    virtual uint8_t read(uint16_t address) = 0;
+    virtual bool busy() = 0;
+    virtual void write(uint16_t address, uint8_t value) = 0;
+};
+
+#endif
@@ -0,0 +1,504 @@
+// Wear levelled sample history log for the sensor drivers
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// Page layout:
+//   0-1  sequence number, 0xFFFF for a page never written
+//   2    bytes of record data used
+//   3    CRC-8 of the other header bytes and the record data
+//   4-7  time of the first record
+//   8-   records: tag (bits 6-4 instance, bits 3-0 type), varint ms since
+//        the previous record, then a zigzag varint per value holding the
+//        change since the previous record of that sensor in the page
+//
+// Every page stands alone, so a page can be read without its neighbours.
+// A page is written with its sequence number set to 0xFFFF first, then
+// the header and records, then the real sequence number to commit it. A
+// page torn by a reset reads as never written, or fails its CRC, which
+// covers the sequence number too; either way begin() and tail() treat it
+// as never written.
+
+#include "Arduino.h"
+#include "SampleLog.h"
+
+#define LOG_ERASED (0xFFFF)
+
+static uint8_t channels(uint8_t type) {
+    return type == LOG_COMPASS || type == LOG_GYROSCOPE ? 3 : 1;
+}
+
+static uint8_t putVarint(uint8_t* out, unsigned long value) {
+    uint8_t length = 0;
+    while (value >= 0x80) {
+        out[length++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    out[length++] = value;
+    return length;
+}
+
+static unsigned long getVarint(const uint8_t* data, uint8_t& pos) {
+    unsigned long value = 0;
+    uint8_t shift = 0;
+    uint8_t b;
+    do {
+        b = data[pos++];
+        value |= (unsigned long) (b & 0x7F) << shift;
+        shift += 7;
+    } while ((b & 0x80) && shift < 35);
+    return value;
+}
+
+// CRC-8 (polynomial 0x07) of a page's header, less the CRC byte itself,
+// and its record data.
+static uint8_t pageCrc(const uint8_t* page) {
+    uint8_t crc = 0;
+    uint8_t end = LOG_HEADER_SIZE + page[2];
+    for (uint8_t i=0; i < end; i++) {
+        if (i == 3) {
+            continue;
+        }
+        crc ^= page[i];
+        for (uint8_t bit=0; bit < 8; bit++) {
+            crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// Skip over a page's records to count them, without rebuilding values.
+static int countRecords(const uint8_t* page) {
+    uint8_t end = LOG_HEADER_SIZE + page[2];
+    uint8_t pos = LOG_HEADER_SIZE;
+    int found = 0;
+
+    while (pos < end) {
+        // The tag, then the time and a value per channel, each a varint.
+        uint8_t varints = 1 + channels(page[pos++] & 0x0F);
+        while (varints > 0 && pos < end) {
+            if (!(page[pos++] & 0x80)) {
+                varints--;
+            }
+        }
+        found++;
+    }
+    return found;
+}
+
+/**
+ * Constructor. Call begin() before logging.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param storage Where the log is kept. Its size is rounded 
+ *                down to whole pages.
+ */
+SampleLog::SampleLog(LogStorage& storage) {
+    this->_storage = &storage;
+    this->_pages = 0;
+}
+
+/**
+ * Find the newest page in storage so logging carries on after 
+ * it. This reads every page once. A page that fails its CRC, 
+ * e.g. one torn by a reset, counts as never written. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void SampleLog::begin() {
+    this->_pages = this->_storage->size() / LOG_PAGE_SIZE;
+    this->_head = 0;
+    this->_sequence = 0;
+    this->_writing = false;
+    this->_used = 0;
+    if (this->_pages == 0) {
+        return;
+    }
+
+    // The newest page is the last of the run of consecutive sequence
+    // numbers, i.e. the one whose successor was not written after it.
+    uint8_t data[LOG_PAGE_SIZE];
+    bool firstValid = this->readPage(0, data);
+    uint16_t firstSeq = data[0] | data[1] << 8;
+    bool valid = firstValid;
+    uint16_t seq = firstSeq;
+
+    for (uint16_t page=0; page < this->_pages; page++) {
+        uint16_t next = (page + 1) % this->_pages;
+        bool nextValid = firstValid;
+        uint16_t nextSeq = firstSeq;
+        if (next != 0) {
+            nextValid = this->readPage(next, data);
+            nextSeq = data[0] | data[1] << 8;
+        }
+
+        uint16_t expected = seq + 1 == LOG_ERASED ? 0 : seq + 1;
+        if (valid && (!nextValid || nextSeq != expected)) {
+            this->_head = next;
+            this->_sequence = expected;
+            break;
+        }
+        valid = nextValid;
+        seq = nextSeq;
+    }
+}
+
+/**
+ * Log a compass sample, e.g. Compass::rawX, rawY and rawZ.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param time The sample time in milliseconds.
+ * @param x Raw X.
+ * @param y Raw Y.
+ * @param z Raw Z.
+ * @param instance Which compass, 0 - 7.
+ * @return false if the sample had to be dropped.
+ */
+bool SampleLog::compass(unsigned long time, int x, int y, int z, uint8_t instance) {
+    long values[3] = { x, y, z };
+    return this->append(LOG_COMPASS, instance, time, values);
+}
+
+/**
+ * Log a gyroscope sample, e.g. Gyroscope::x, y and z.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param time The sample time in milliseconds.
+ * @param x Raw X rate.
+ * @param y Raw Y rate.
+ * @param z Raw Z rate.
+ * @param instance Which gyroscope, 0 - 7.
+ * @return false if the sample had to be dropped.
+ */
+bool SampleLog::gyroscope(unsigned long time, int x, int y, int z, uint8_t instance) {
+    long values[3] = { x, y, z };
+    return this->append(LOG_GYROSCOPE, instance, time, values);
+}
+
+/**
+ * Log a range, e.g. from PingRanger::update().
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param time The sample time in milliseconds.
+ * @param mm The range in millimeters.
+ * @param instance Which sensor, 0 - 7.
+ * @return false if the sample had to be dropped.
+ */
+bool SampleLog::ping(unsigned long time, long mm, uint8_t instance) {
+    return this->append(LOG_PING, instance, time, &mm);
+}
+
+/**
+ * Log a temperature, e.g. from TMP36::temperatureDeciC().
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param time The sample time in milliseconds.
+ * @param deciC The temperature in tenths of a degree C.
+ * @param instance Which sensor, 0 - 7.
+ * @return false if the sample had to be dropped.
+ */
+bool SampleLog::temperature(unsigned long time, int deciC, uint8_t instance) {
+    long value = deciC;
+    return this->append(LOG_TEMPERATURE, instance, time, &value);
+}
+
+/**
+ * Add a record to the page being filled in RAM. Nothing is 
+ * written to storage here; a full page is handed to poll() to 
+ * write out in the background. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param type One of the LOG_ sensor types.
+ * @param instance Which sensor of that type, 0 - 7.
+ * @param time The sample time in milliseconds.
+ * @param values One value per channel of the type.
+ * @return false if the page is full and the previous page is 
+ *         still being written, in which case the record is
+ *         dropped. Call poll() more often if this happens.
+ */
+bool SampleLog::append(uint8_t type, uint8_t instance, unsigned long time, const long values[]) {
+    if (this->_pages == 0) {
+        return false;
+    }
+    if (this->_used == 0) {
+        this->startPage(time);
+    }
+
+    uint8_t record[3 + 5 + LOG_MAX_CHANNELS * 5];
+    uint8_t length = this->encode(record, type, instance, time, values);
+
+    if (LOG_HEADER_SIZE + this->_used + length > LOG_PAGE_SIZE) {
+        if (!this->flush()) {
+            return false;
+        }
+        this->startPage(time);
+        length = this->encode(record, type, instance, time, values);
+    }
+
+    // Only commit the sensor state once the record is in the page.
+    Sensor* sensor = 0;
+    uint8_t tag = (instance & 0x07) << 4 | (type & 0x0F);
+    for (uint8_t i=0; i < LOG_SENSORS && sensor == 0; i++) {
+        if (this->_sensors[i].tag == tag || this->_sensors[i].tag == 0) {
+            sensor = &this->_sensors[i];
+        }
+    }
+    if (sensor != 0) {
+        sensor->tag = tag;
+        for (uint8_t i=0; i < channels(type); i++) {
+            sensor->values[i] = values[i];
+        }
+    }
+
+    memcpy(this->_page + LOG_HEADER_SIZE + this->_used, record, length);
+    this->_used += length;
+    this->_lastTime = time;
+    return true;
+}
+
+/**
+ * Close the page being filled and queue it for poll() to write, 
+ * e.g. before a planned power down. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return false if the previous page is still being written.
+ */
+bool SampleLog::flush() {
+    if (this->_used == 0) {
+        return true;
+    }
+    if (this->_writing) {
+        return false;
+    }
+
+    this->_page[0] = this->_sequence & 0xFF;
+    this->_page[1] = this->_sequence >> 8;
+    this->_page[2] = this->_used;
+    this->_page[3] = pageCrc(this->_page);
+    memcpy(this->_pending, this->_page, LOG_PAGE_SIZE);
+
+    this->_writing = true;
+    this->_writePos = 0;
+    this->_writePage = this->_head;
+
+    this->_head = (this->_head + 1) % this->_pages;
+    this->_sequence++;
+    if (this->_sequence == LOG_ERASED) {
+        this->_sequence = 0;
+    }
+    this->_used = 0;
+    return true;
+}
+
+/**
+ * Write queued page bytes while the storage is ready. Call from 
+ * loop(). With EEPROM this writes one byte per call and never 
+ * waits for a write to finish. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void SampleLog::poll() {
+    while (this->_writing && !this->_storage->busy()) {
+        uint16_t address = this->_writePage * LOG_PAGE_SIZE;
+        uint8_t end = LOG_HEADER_SIZE + this->_pending[2];
+
+        // Mark the page unwritten, write the header and records, then
+        // the sequence number to commit.
+        if (this->_writePos < 2) {
+            this->_storage->write(address + this->_writePos, 0xFF);
+        } else if (this->_writePos < end) {
+            this->_storage->write(address + this->_writePos, this->_pending[this->_writePos]);
+        } else if (this->_writePos == end) {
+            this->_storage->write(address + 1, this->_pending[1]);
+        } else {
+            this->_storage->write(address, this->_pending[0]);
+            this->_writing = false;
+        }
+        this->_writePos++;
+    }
+}
+
+/**
+ * Checks if everything flushed has reached storage.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return true when no page is waiting to be written.
+ */
+bool SampleLog::idle() {
+    return !this->_writing;
+}
+
+/**
+ * Read back the newest records, including those not yet 
+ * written to storage. Reading starts from the head of the log 
+ * and stops as soon as enough records are found. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param out Receives the records, oldest first.
+ * @param count The most records to return.
+ * @return The number of records returned.
+ */
+int SampleLog::tail(LogRecord out[], int count) {
+    uint8_t data[LOG_PAGE_SIZE];
+    int remaining = count;
+
+    // Newest first: the page being filled, the page being written, then
+    // storage pages going backwards from the head.
+    for (uint16_t back=0; remaining > 0 && back <= this->_pages + 1; back++) {
+        if (back == 0) {
+            if (this->_used == 0) {
+                continue;
+            }
+            memcpy(data, this->_page, LOG_HEADER_SIZE);
+            data[2] = this->_used;
+            memcpy(data + LOG_HEADER_SIZE, this->_page + LOG_HEADER_SIZE, this->_used);
+        } else if (back == 1) {
+            if (!this->_writing) {
+                continue;
+            }
+            memcpy(data, this->_pending, LOG_PAGE_SIZE);
+        } else {
+            uint16_t steps = back - 1 + (this->_writing ? 1 : 0);
+            if (steps > this->_pages) {
+                break;
+            }
+            uint16_t page = (this->_head + this->_pages - steps) % this->_pages;
+            if (!this->readPage(page, data)) {
+                // Never written, or torn by a reset; older pages may
+                // still hold records.
+                continue;
+            }
+        }
+
+        int found = countRecords(data);
+        int take = found < remaining ? found : remaining;
+        decode(data, out + remaining - take, found - take, take);
+        remaining -= take;
+    }
+
+    if (remaining > 0) {
+        memmove(out, out + remaining, (count - remaining) * sizeof(LogRecord));
+    }
+    return count - remaining;
+}
+
+/**
+ * Gets the number of pages in the storage.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The page count.
+ */
+uint16_t SampleLog::pages() {
+    return this->_pages;
+}
+
+uint8_t SampleLog::encode(uint8_t out[], uint8_t type, uint8_t instance, unsigned long time, const long values[]) {
+    uint8_t tag = (instance & 0x07) << 4 | (type & 0x0F);
+    const long* previous = 0;
+
+    for (uint8_t i=0; i < LOG_SENSORS; i++) {
+        if (this->_sensors[i].tag == tag) {
+            previous = this->_sensors[i].values;
+            break;
+        }
+    }
+
+    uint8_t length = 0;
+    out[length++] = tag;
+    length += putVarint(out + length, time - this->_lastTime);
+    for (uint8_t i=0; i < channels(type); i++) {
+        long value = previous != 0 ? values[i] - previous[i] : values[i];
+        length += putVarint(out + length, ((unsigned long) value << 1) ^ (unsigned long) (value >> 31));
+    }
+    return length;
+}
+
+void SampleLog::startPage(unsigned long time) {
+    this->_page[4] = time & 0xFF;
+    this->_page[5] = (time >> 8) & 0xFF;
+    this->_page[6] = (time >> 16) & 0xFF;
+    this->_page[7] = time >> 24;
+    this->_lastTime = time;
+    for (uint8_t i=0; i < LOG_SENSORS; i++) {
+        this->_sensors[i].tag = 0;
+    }
+}
+
+bool SampleLog::readPage(uint16_t page, uint8_t data[]) {
+    uint16_t address = page * LOG_PAGE_SIZE;
+
+    for (uint8_t i=0; i < LOG_HEADER_SIZE; i++) {
+        data[i] = this->_storage->read(address + i);
+    }
+    uint16_t seq = data[0] | data[1] << 8;
+    if (seq == LOG_ERASED || data[2] > LOG_PAGE_SIZE - LOG_HEADER_SIZE) {
+        return false;
+    }
+    for (uint8_t i=0; i < data[2]; i++) {
+        data[LOG_HEADER_SIZE + i] = this->_storage->read(address + LOG_HEADER_SIZE + i);
+    }
+    return pageCrc(data) == data[3];
+}
+
+// Decode the records of a page, skipping the first skip.
+int SampleLog::decode(const uint8_t page[], LogRecord out[], int skip, int count) {
+    struct {
+        uint8_t tag;
+        long values[LOG_MAX_CHANNELS];
+    } sensors[LOG_SENSORS];
+    uint8_t known = 0;
+    uint8_t end = LOG_HEADER_SIZE + page[2];
+    uint8_t pos = LOG_HEADER_SIZE;
+    unsigned long time = page[4] | (unsigned long) page[5] << 8 | (unsigned long) page[6] << 16 | (unsigned long) page[7] << 24;
+    int found = 0;
+
+    while (pos < end) {
+        LogRecord record;
+        uint8_t tag = page[pos++];
+        record.type = tag & 0x0F;
+        record.instance = (tag >> 4) & 0x07;
+        record.channels = channels(record.type);
+        time += getVarint(page, pos);
+        record.time = time;
+
+        int8_t sensor = -1;
+        for (uint8_t i=0; i < known; i++) {
+            if (sensors[i].tag == tag) {
+                sensor = i;
+            }
+        }
+        if (sensor < 0 && known < LOG_SENSORS) {
+            sensor = known++;
+            sensors[sensor].tag = tag;
+            memset(sensors[sensor].values, 0, sizeof(sensors[sensor].values));
+        }
+
+        for (uint8_t i=0; i < record.channels; i++) {
+            unsigned long zigzag = getVarint(page, pos);
+            long value = (long) (zigzag >> 1) ^ -(long) (zigzag & 1);
+            if (sensor >= 0) {
+                value += sensors[sensor].values[i];
+                sensors[sensor].values[i] = value;
+            }
+            record.values[i] = value;
+        }
+
+        if (found >= skip && found - skip < count) {
+            out[found - skip] = record;
+        }
+        found++;
+    }
+    return found;
+}
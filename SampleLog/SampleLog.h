@@ -0,0 +1,77 @@
+// Wear levelled sample history log for the sensor drivers
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef SampleLog_h
+#define SampleLog_h
+
+#include "Arduino.h"
+#include "LogStorage.h"
+
+// Sensor types and the number of values each record carries.
+#define LOG_COMPASS         (1)     // raw X, Y, Z
+#define LOG_GYROSCOPE       (2)     // raw X, Y, Z
+#define LOG_PING            (3)     // range in mm
+#define LOG_TEMPERATURE     (4)     // tenths of a degree C
+#define LOG_MAX_CHANNELS    (3)
+
+// Storage is split into pages written in turn around a ring, so every
+// page sees the same wear. Two pages are buffered in RAM.
+#ifndef LOG_PAGE_SIZE
+#define LOG_PAGE_SIZE       (32)
+#endif
+#define LOG_HEADER_SIZE     (8)
+// Sensors tracked for delta encoding within a page.
+#ifndef LOG_SENSORS
+#define LOG_SENSORS         (4)
+#endif
+
+// One sample read back from the log.
+struct LogRecord {
+    uint8_t type;
+    uint8_t instance;
+    uint8_t channels;
+    unsigned long time;
+    long values[LOG_MAX_CHANNELS];
+};
+
+// See .cpp source for method documentation.
+class SampleLog {
+public:
+    SampleLog(LogStorage& storage);
+    void begin();
+    bool compass(unsigned long time, int x, int y, int z, uint8_t instance = 0);
+    bool gyroscope(unsigned long time, int x, int y, int z, uint8_t instance = 0);
+    bool ping(unsigned long time, long mm, uint8_t instance = 0);
+    bool temperature(unsigned long time, int deciC, uint8_t instance = 0);
+    bool append(uint8_t type, uint8_t instance, unsigned long time, const long values[]);
+    bool flush();
+    void poll();
+    bool idle();
+    int tail(LogRecord out[], int count);
+    uint16_t pages();
+private:
+    struct Sensor {
+        uint8_t tag;
+        long values[LOG_MAX_CHANNELS];
+    };
+    LogStorage* _storage;
+    uint16_t _pages;
+    uint16_t _head;
+    uint16_t _sequence;
+    uint8_t _page[LOG_PAGE_SIZE];
+    uint8_t _used;
+    unsigned long _lastTime;
+    Sensor _sensors[LOG_SENSORS];
+    uint8_t _pending[LOG_PAGE_SIZE];
+    bool _writing;
+    uint8_t _writePos;
+    uint16_t _writePage;
+    uint8_t encode(uint8_t out[], uint8_t type, uint8_t instance, unsigned long time, const long values[]);
+    void startPage(unsigned long time);
+    bool readPage(uint16_t page, uint8_t data[]);
+    static int decode(const uint8_t page[], LogRecord out[], int skip, int count);
+};
+
+#endif
@@ -0,0 +1,70 @@
+// File backed stand-in for the SampleLog storage, for host testing
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef FileLogStorage_h
+#define FileLogStorage_h
+
+#include <stdio.h>
+#include "LogStorage.h"
+
+// Keeps the log image in a file so it survives between runs, like the
+// EEPROM survives a reset. A new file starts erased (0xFF). Writes are
+// counted per byte so wear levelling can be checked.
+class FileLogStorage : public LogStorage {
+public:
+    FileLogStorage(const char* path, uint16_t size) {
+        this->_size = size;
+        this->_writes = 0;
+        this->_counts = new unsigned long[size]();
+        this->_file = fopen(path, "r+b");
+        if (this->_file == 0) {
+            this->_file = fopen(path, "w+b");
+            for (uint16_t i=0; this->_file != 0 && i < size; i++) {
+                fputc(0xFF, this->_file);
+            }
+        }
+    }
+    virtual ~FileLogStorage() {
+        if (this->_file != 0) {
+            fclose(this->_file);
+        }
+        delete[] this->_counts;
+    }
+    bool ok() {
+        return this->_file != 0;
+    }
+    unsigned long writes() {
+        return this->_writes;
+    }
+    unsigned long writes(uint16_t address) {
+        return address < this->_size ? this->_counts[address] : 0;
+    }
+    virtual uint16_t size() {
+        return this->_size;
+    }
+    virtual uint8_t read(uint16_t address) {
+        fseek(this->_file, address, SEEK_SET);
+        return fgetc(this->_file);
+    }
+    virtual bool busy() {
+        return false;
+    }
+    virtual void write(uint16_t address, uint8_t value) {
+        fseek(this->_file, address, SEEK_SET);
+        fputc(value, this->_file);
+        fflush(this->_file);
+        this->_writes++;
+        if (address < this->_size) {
+            this->_counts[address]++;
+        }
+    }
+private:
+    FILE* _file;
+    uint16_t _size;
+    unsigned long _writes;
+    unsigned long* _counts;
+};
+
+#endif
@@ -0,0 +1,158 @@
+// Duty cycling power manager for the Compass and Gyroscope drivers
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include "SensorPower.h"
+
+/**
+ * Constructor. No sensors are managed until attached.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+SensorPower::SensorPower() {
+    this->_compass = 0;
+    this->_gyro = 0;
+}
+
+/**
+ * Manage a compass. Between samples it sits idle; each sample is 
+ * a single measurement started early enough to be read within 
+ * the latency target. If samples are needed faster than a 
+ * measurement takes, the compass is left in continuous mode. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param compass The compass, already started with begin().
+ * @param period Time between samples in milliseconds.
+ * @param latency How late after its due time a sample may be 
+ *                delivered, in milliseconds.
+ */
+void SensorPower::attachCompass(Compass& compass, unsigned long period, unsigned long latency) {
+    this->_compass = &compass;
+    this->plan(this->_compassSchedule, period, latency, POWER_COMPASS_MEASURE_MS);
+    if (this->_compassSchedule.alwaysOn) {
+        compass.setModeContinuous();
+    } else {
+        compass.setModeSleep();
+    }
+}
+
+/**
+ * Manage a gyroscope. Between samples it is powered down; it is 
+ * woken ahead of each sample to allow for its turn on time, 
+ * less the latency target. If it would have to be woken again 
+ * almost as soon as it was put down, it is left running. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param gyro The gyroscope, already started with begin().
+ * @param period Time between samples in milliseconds.
+ * @param latency How late after its due time a sample may be 
+ *                delivered, in milliseconds.
+ */
+void SensorPower::attachGyroscope(Gyroscope& gyro, unsigned long period, unsigned long latency) {
+    this->_gyro = &gyro;
+    this->plan(this->_gyroSchedule, period, latency, POWER_GYRO_TURN_ON_MS);
+    if (this->_gyroSchedule.alwaysOn) {
+        gyro.setModeDefault();
+    } else {
+        gyro.setModeSleep();
+    }
+}
+
+/**
+ * Wake, read and sleep the sensors as their schedules require. 
+ * Call from loop(); it never waits on a sensor. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return POWER_COMPASS and/or POWER_GYROSCOPE for each sensor 
+ *         whose members hold a fresh sample.
+ */
+uint8_t SensorPower::poll() {
+    unsigned long now = millis();
+    uint8_t ready = 0;
+
+    if (this->_compass != 0) {
+        Schedule& s = this->_compassSchedule;
+        if (s.alwaysOn) {
+            if ((long) (now - s.due) >= 0) {
+                this->_compass->read();
+                this->next(s, now);
+                ready |= POWER_COMPASS;
+            }
+        } else if (!s.awake) {
+            if ((long) (now - (s.due - s.lead)) >= 0) {
+                this->_compass->trigger();
+                s.awake = true;
+            }
+        } else if (this->_compass->collect()) {
+            // The compass returns to idle by itself after the measurement.
+            s.awake = false;
+            this->next(s, now);
+            ready |= POWER_COMPASS;
+        }
+    }
+
+    if (this->_gyro != 0) {
+        Schedule& s = this->_gyroSchedule;
+        if (s.alwaysOn) {
+            if ((long) (now - s.due) >= 0) {
+                this->_gyro->read();
+                this->next(s, now);
+                ready |= POWER_GYROSCOPE;
+            }
+        } else if (!s.awake) {
+            if ((long) (now - (s.due - s.lead)) >= 0) {
+                this->_gyro->setModeDefault();
+                s.start = now;
+                s.awake = true;
+            }
+        } else if (now - s.start >= POWER_GYRO_TURN_ON_MS) {
+            this->_gyro->read();
+            this->_gyro->setModeSleep();
+            s.awake = false;
+            this->next(s, now);
+            ready |= POWER_GYROSCOPE;
+        }
+    }
+
+    return ready;
+}
+
+/**
+ * Gets the estimated fraction of time a sensor is powered.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param sensor POWER_COMPASS or POWER_GYROSCOPE.
+ * @return The duty cycle in parts per thousand.
+ */
+unsigned int SensorPower::dutyCycle(uint8_t sensor) {
+    Schedule& s = sensor == POWER_COMPASS ? this->_compassSchedule : this->_gyroSchedule;
+    unsigned long wake = sensor == POWER_COMPASS ? POWER_COMPASS_MEASURE_MS : POWER_GYRO_TURN_ON_MS;
+
+    if (s.alwaysOn || s.period == 0) {
+        return 1000;
+    }
+    return (wake + POWER_READ_MS) * 1000 / s.period;
+}
+
+void SensorPower::plan(Schedule& schedule, unsigned long period, unsigned long latency, unsigned long wake) {
+    schedule.period = period;
+    schedule.lead = latency < wake ? wake - latency : 0;
+    schedule.alwaysOn = period <= wake + POWER_READ_MS;
+    schedule.awake = false;
+    schedule.due = millis() + schedule.lead;
+}
+
+// Advance to the next due time, skipping any that have already passed.
+void SensorPower::next(Schedule& schedule, unsigned long now) {
+    schedule.due += schedule.period;
+    if ((long) (now - schedule.due) > 0) {
+        schedule.due += ((now - schedule.due) / schedule.period + 1) * schedule.period;
+    }
+}
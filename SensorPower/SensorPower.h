@@ -0,0 +1,49 @@
+// Duty cycling power manager for the Compass and Gyroscope drivers
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef SensorPower_h
+#define SensorPower_h
+
+#include "Arduino.h"
+#include "Compass.h"
+#include "Gyroscope.h"
+
+// Sensor flags returned by poll().
+#define POWER_COMPASS           (0x01)
+#define POWER_GYROSCOPE         (0x02)
+
+// HMC5883L single measurement time and L3G4200D time from power down to
+// settled output (depends on ODR and filters, see the datasheet).
+#define POWER_COMPASS_MEASURE_MS ((COMPASS_MEASURE_US + 999) / 1000)
+#define POWER_GYRO_TURN_ON_MS    (250)
+// Time spent awake to read a sample once the data is valid.
+#define POWER_READ_MS            (1)
+
+// See .cpp source for method documentation.
+class SensorPower {
+public:
+    SensorPower();
+    void attachCompass(Compass& compass, unsigned long period, unsigned long latency);
+    void attachGyroscope(Gyroscope& gyro, unsigned long period, unsigned long latency);
+    uint8_t poll();
+    unsigned int dutyCycle(uint8_t sensor);
+private:
+    struct Schedule {
+        unsigned long period;
+        unsigned long lead;
+        unsigned long due;
+        unsigned long start;
+        bool alwaysOn;
+        bool awake;
+    };
+    Compass* _compass;
+    Gyroscope* _gyro;
+    Schedule _compassSchedule;
+    Schedule _gyroSchedule;
+    void plan(Schedule& schedule, unsigned long period, unsigned long latency, unsigned long wake);
+    void next(Schedule& schedule, unsigned long now);
+};
+
+#endif
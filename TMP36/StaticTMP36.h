@@ -0,0 +1,34 @@
+// Compile time configured TMP36 temperature sensor (http://www.adafruit.com/products/165)
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef StaticTMP36_h
+#define StaticTMP36_h
+
+#include "Arduino.h"
+
+// TMP36 with the pin and reference voltage fixed at compile time. All
+// methods are static, so it takes no RAM at all:
+//   typedef StaticTMP36<A0> Outside;
+//   int t = Outside::temperatureDeciC();
+template <uint8_t PIN, bool IS_5V = true>
+class StaticTMP36 {
+public:
+    static long mV() {
+        return (long) analogRead(PIN) * VREF / 1024;
+    }
+    static int temperatureDeciC() {
+        return mV() - 500;
+    }
+    static float temperatureC() {
+        return (mV() - 500) / 10.0;
+    }
+    static float temperatureF() {
+        return temperatureC() * 9.0 / 5.0 + 32;
+    }
+private:
+    static const int VREF = IS_5V ? 5000 : 3300;
+};
+
+#endif
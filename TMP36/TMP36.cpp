@@ -6,6 +6,13 @@
 #include "Arduino.h"
 #include "TMP36.h"
 
+#ifdef DRIVER_STATS
+#include <DriverProbe.h>
+#else
+#define DRIVER_PROBE_START()
+#define DRIVER_PROBE_END(probe, miss)
+#endif
+
 /**
  * Constructor. Assumes that sensor Vref is set to 5V.
  *  
@@ -44,7 +51,9 @@ TMP36::TMP36(int pin, bool is5V) {
  * @return The milivolts read at the pin.
  */
 long TMP36::mV() {
+    DRIVER_PROBE_START();
     int reading = analogRead(this->_pin);
+    DRIVER_PROBE_END(DRIVER_TMP36_MV, false);
 
     return (float) reading * this->_Vref / 1024.0;
 }
@@ -75,6 +84,21 @@ float TMP36::temperatureF() {
     return (float) temperatureC* 9.0/5.0 + 32;
 }
 
+/**
+ * Gets the temperature in tenths of a C using integer math 
+ * only. The sensor outputs 10mV/C with a 500mV offset, so this 
+ * is simply the pin voltage less the offset. 
+ * 
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The temperature in tenths of a C.
+ */
+int TMP36::temperatureDeciC() {
+    int reading = analogRead(this->_pin);
+
+    return (long) reading * this->_Vref / 1024 - 500;
+}
+
 void TMP36::setPin(int pin) {
     this->_pin = pin;
 }
@@ -15,6 +15,7 @@ public:
     long mV();
     float temperatureC();
     float temperatureF();
+    int temperatureDeciC();
     void setPin(int pin);
     void setIs5V(bool is5V);
 private:
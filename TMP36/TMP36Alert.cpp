@@ -0,0 +1,254 @@
+// Threshold and rate of change alerts for a TMP36 temperature sensor
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include "TMP36Alert.h"
+
+/**
+ * Constructor. No alerts are enabled until setHigh(), setLow() 
+ * or setRate() is called. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param sensor The sensor poll() reads.
+ */
+TMP36Alert::TMP36Alert(TMP36& sensor) {
+    this->_sensor = &sensor;
+    this->_callback = 0;
+    this->_enabled = 0;
+    this->_state = 0;
+    this->_high = 0;
+    this->_highHysteresis = 0;
+    this->_low = 0;
+    this->_lowHysteresis = 0;
+    this->_rateLimit = 0;
+    this->_rateHysteresis = 0;
+    this->_window = TMP36_ALERT_WINDOW_MS;
+    this->_interval = TMP36_ALERT_INTERVAL_MS;
+    this->_lastSample = 0;
+    this->_started = false;
+    this->_deciC = 0;
+    this->_smoothed = 0;
+    this->_reference = 0;
+    this->_referenceTime = 0;
+    this->_rate = 0;
+}
+
+/**
+ * Alert when the temperature reaches deciC. The alert clears 
+ * once it drops to deciC - hysteresis, so noise around the 
+ * limit does not make it flicker. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param deciC The limit in tenths of a degree C.
+ * @param hysteresis How far below the limit it must fall to 
+ *                   clear, in tenths of a degree C.
+ */
+void TMP36Alert::setHigh(int deciC, int hysteresis) {
+    this->_high = deciC;
+    this->_highHysteresis = hysteresis;
+    this->_enabled |= TMP36_ALERT_HIGH;
+}
+
+/**
+ * Alert when the temperature falls to deciC. The alert clears 
+ * once it rises to deciC + hysteresis. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param deciC The limit in tenths of a degree C.
+ * @param hysteresis How far above the limit it must rise to 
+ *                   clear, in tenths of a degree C.
+ */
+void TMP36Alert::setLow(int deciC, int hysteresis) {
+    this->_low = deciC;
+    this->_lowHysteresis = hysteresis;
+    this->_enabled |= TMP36_ALERT_LOW;
+}
+
+/**
+ * Alert when the temperature changes faster than a limit in 
+ * either direction. The rate is measured over windowMs from 
+ * smoothed samples, so it is updated once per window. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param deciCPerMinute The rate limit in tenths of a degree C 
+ *                       per minute.
+ * @param hysteresis How far below the limit the rate must fall 
+ *                   to clear.
+ * @param windowMs The time the rate is measured over. Use 
+ *                 several sample intervals.
+ */
+void TMP36Alert::setRate(int deciCPerMinute, int hysteresis, unsigned int windowMs) {
+    this->_rateLimit = deciCPerMinute;
+    this->_rateHysteresis = hysteresis;
+    this->_window = windowMs;
+    this->_enabled |= TMP36_ALERT_RISING | TMP36_ALERT_FALLING;
+}
+
+/**
+ * Turn alerts off. Any that were active are cleared without a 
+ * callback. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param alerts TMP36_ALERT_ bits to turn off.
+ */
+void TMP36Alert::disable(uint8_t alerts) {
+    this->_enabled &= ~alerts;
+    this->_state &= ~alerts;
+}
+
+/**
+ * Set how often poll() reads the sensor. Fewer samples mean 
+ * fewer ADC conversions. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param ms Time between samples in milliseconds.
+ */
+void TMP36Alert::setInterval(unsigned int ms) {
+    this->_interval = ms;
+}
+
+/**
+ * Set a function to call whenever an alert starts or stops.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param callback The function, or 0 for none.
+ */
+void TMP36Alert::setCallback(TMP36AlertCallback callback) {
+    this->_callback = callback;
+}
+
+/**
+ * Read the sensor if a sample is due and check the alerts. Call 
+ * from loop(); between samples this costs only a millis() 
+ * check. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The alert bits that changed, 0 if none did or no 
+ *         sample was due.
+ */
+uint8_t TMP36Alert::poll() {
+    unsigned long now = millis();
+
+    if (this->_started && now - this->_lastSample < this->_interval) {
+        return 0;
+    }
+    return this->update(this->_sensor->temperatureDeciC(), now);
+}
+
+/**
+ * Check the alerts against a sample taken elsewhere, for 
+ * example from a StaticTMP36. Each sample is integer work of a 
+ * fixed size. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param deciC The temperature in tenths of a degree C.
+ * @param now The time of the sample in milliseconds.
+ * @return The alert bits that changed.
+ */
+uint8_t TMP36Alert::update(int deciC, unsigned long now) {
+    this->_lastSample = now;
+    this->_deciC = deciC;
+
+    // Rates come from a smoothed temperature (Q4) so single noisy
+    // samples do not trip them.
+    if (!this->_started) {
+        this->_started = true;
+        this->_smoothed = (long) deciC << 4;
+        this->_reference = this->_smoothed;
+        this->_referenceTime = now;
+    } else {
+        this->_smoothed += (((long) deciC << 4) - this->_smoothed) / 4;
+    }
+
+    uint8_t state = this->_state;
+
+    if (this->_enabled & TMP36_ALERT_HIGH) {
+        if (deciC >= this->_high) {
+            state |= TMP36_ALERT_HIGH;
+        } else if (deciC <= this->_high - this->_highHysteresis) {
+            state &= ~TMP36_ALERT_HIGH;
+        }
+    }
+
+    if (this->_enabled & TMP36_ALERT_LOW) {
+        if (deciC <= this->_low) {
+            state |= TMP36_ALERT_LOW;
+        } else if (deciC >= this->_low + this->_lowHysteresis) {
+            state &= ~TMP36_ALERT_LOW;
+        }
+    }
+
+    unsigned long elapsed = now - this->_referenceTime;
+    if (elapsed >= this->_window && elapsed > 0) {
+        this->_rate = (this->_smoothed - this->_reference) * 60000L / 16 / (long) elapsed;
+        this->_reference = this->_smoothed;
+        this->_referenceTime = now;
+
+        if (this->_enabled & TMP36_ALERT_RISING) {
+            if (this->_rate >= this->_rateLimit) {
+                state |= TMP36_ALERT_RISING;
+            } else if (this->_rate <= this->_rateLimit - this->_rateHysteresis) {
+                state &= ~TMP36_ALERT_RISING;
+            }
+        }
+        if (this->_enabled & TMP36_ALERT_FALLING) {
+            if (-this->_rate >= this->_rateLimit) {
+                state |= TMP36_ALERT_FALLING;
+            } else if (-this->_rate <= this->_rateLimit - this->_rateHysteresis) {
+                state &= ~TMP36_ALERT_FALLING;
+            }
+        }
+    }
+
+    uint8_t changed = state ^ this->_state;
+    this->_state = state;
+    if (changed && this->_callback != 0) {
+        this->_callback(state, changed, deciC);
+    }
+    return changed;
+}
+
+/**
+ * Gets the alerts that are active.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return TMP36_ALERT_ bits.
+ */
+uint8_t TMP36Alert::state() {
+    return this->_state;
+}
+
+/**
+ * Gets the last sample.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return The temperature in tenths of a degree C.
+ */
+int TMP36Alert::temperature() {
+    return this->_deciC;
+}
+
+/**
+ * Gets the last measured rate of change.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return Tenths of a degree C per minute, positive when 
+ *         warming.
+ */
+int TMP36Alert::rate() {
+    return this->_rate;
+}
@@ -0,0 +1,64 @@
+// Threshold and rate of change alerts for a TMP36 temperature sensor
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef TMP36Alert_h
+#define TMP36Alert_h
+
+#include "Arduino.h"
+#include "TMP36.h"
+
+// Alert bits reported by state() and passed to the callback.
+#define TMP36_ALERT_HIGH    (0x01)
+#define TMP36_ALERT_LOW     (0x02)
+#define TMP36_ALERT_RISING  (0x04)
+#define TMP36_ALERT_FALLING (0x08)
+
+// Time between samples taken by poll() unless setInterval() is used.
+#define TMP36_ALERT_INTERVAL_MS (1000)
+// Window rate() is measured over until setRate() gives another.
+#define TMP36_ALERT_WINDOW_MS   (10000)
+
+// Called with the alerts now active, the ones that just changed and the
+// temperature in tenths of a degree C.
+typedef void (*TMP36AlertCallback)(uint8_t state, uint8_t changed, int deciC);
+
+// See .cpp source for method documentation.
+class TMP36Alert {
+public:
+    TMP36Alert(TMP36& sensor);
+    void setHigh(int deciC, int hysteresis);
+    void setLow(int deciC, int hysteresis);
+    void setRate(int deciCPerMinute, int hysteresis, unsigned int windowMs);
+    void disable(uint8_t alerts);
+    void setInterval(unsigned int ms);
+    void setCallback(TMP36AlertCallback callback);
+    uint8_t poll();
+    uint8_t update(int deciC, unsigned long now);
+    uint8_t state();
+    int temperature();
+    int rate();
+private:
+    TMP36* _sensor;
+    TMP36AlertCallback _callback;
+    uint8_t _enabled;
+    uint8_t _state;
+    int _high;
+    int _highHysteresis;
+    int _low;
+    int _lowHysteresis;
+    int _rateLimit;
+    int _rateHysteresis;
+    unsigned int _window;
+    unsigned int _interval;
+    unsigned long _lastSample;
+    bool _started;
+    int _deciC;
+    long _smoothed;
+    long _reference;
+    unsigned long _referenceTime;
+    int _rate;
+};
+
+#endif
@@ -0,0 +1,169 @@
+// Packed binary telemetry encoder for the sensor drivers
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include "TelemetryEncoder.h"
+
+/**
+ * Constructor. The first record from each sensor is a key 
+ * record. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param out Where frames are written, usually Serial.
+ */
+TelemetryEncoder::TelemetryEncoder(Print& out) {
+    this->_out = &out;
+    this->_sequence = 0;
+    for (uint8_t i=0; i < TELEMETRY_SENSORS; i++) {
+        this->_sensors[i].tag = 0;
+    }
+}
+
+/**
+ * Send a compass sample, e.g. Compass::rawX, rawY and rawZ.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param time The sample time in milliseconds.
+ * @param x Raw X.
+ * @param y Raw Y.
+ * @param z Raw Z.
+ * @param instance Which compass, 0 - 7.
+ */
+void TelemetryEncoder::compass(unsigned long time, int x, int y, int z, uint8_t instance) {
+    long values[3] = { x, y, z };
+    this->record(TELEMETRY_COMPASS, instance, time, values);
+}
+
+/**
+ * Send a gyroscope sample, e.g. Gyroscope::x, y and z.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param time The sample time in milliseconds.
+ * @param x Raw X rate.
+ * @param y Raw Y rate.
+ * @param z Raw Z rate.
+ * @param instance Which gyroscope, 0 - 7.
+ */
+void TelemetryEncoder::gyroscope(unsigned long time, int x, int y, int z, uint8_t instance) {
+    long values[3] = { x, y, z };
+    this->record(TELEMETRY_GYROSCOPE, instance, time, values);
+}
+
+/**
+ * Send a range, e.g. from PingRanger::update().
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param time The sample time in milliseconds.
+ * @param mm The range in millimeters.
+ * @param instance Which sensor, 0 - 7.
+ */
+void TelemetryEncoder::ping(unsigned long time, long mm, uint8_t instance) {
+    this->record(TELEMETRY_PING, instance, time, &mm);
+}
+
+/**
+ * Send a temperature, e.g. from TMP36::temperatureDeciC().
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param time The sample time in milliseconds.
+ * @param deciC The temperature in tenths of a degree C.
+ * @param instance Which sensor, 0 - 7.
+ */
+void TelemetryEncoder::temperature(unsigned long time, int deciC, uint8_t instance) {
+    long value = deciC;
+    this->record(TELEMETRY_TEMPERATURE, instance, time, &value);
+}
+
+/**
+ * Encode and send one record. Refer to TelemetryFormat.h for 
+ * the layout. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param type One of the TELEMETRY_ sensor types.
+ * @param instance Which sensor of that type, 0 - 7.
+ * @param time The sample time in milliseconds.
+ * @param values One value per channel of the type.
+ */
+void TelemetryEncoder::record(uint8_t type, uint8_t instance, unsigned long time, const long values[]) {
+    uint8_t tag = (instance & 0x07) << 4 | (type & 0x0F);
+    uint8_t channels = telemetryChannels(type);
+    Sensor* sensor = 0;
+
+    for (uint8_t i=0; i < TELEMETRY_SENSORS; i++) {
+        if (this->_sensors[i].tag == tag) {
+            sensor = &this->_sensors[i];
+            break;
+        }
+        if (sensor == 0 && this->_sensors[i].tag == 0) {
+            sensor = &this->_sensors[i];
+        }
+    }
+    if (sensor != 0 && sensor->tag != tag) {
+        sensor->tag = tag;
+        sensor->untilKey = 0;
+    }
+
+    bool isKey = sensor == 0 || sensor->untilKey == 0;
+    bool isDelta = !isKey && telemetryIsDelta(type);
+    uint8_t record[TELEMETRY_MAX_RECORD];
+    uint8_t length = 0;
+
+    record[length++] = tag | (isKey ? TELEMETRY_KEY : 0);
+    record[length++] = this->_sequence++;
+    length += telemetryPutVarint(record + length, isKey ? time : time - sensor->time);
+    for (uint8_t i=0; i < channels; i++) {
+        long value = isDelta ? values[i] - sensor->values[i] : values[i];
+        length += telemetryPutVarint(record + length, telemetryZigzag(value));
+    }
+
+    if (sensor != 0) {
+        sensor->untilKey = isKey ? TELEMETRY_KEY_INTERVAL - 1 : sensor->untilKey - 1;
+        sensor->time = time;
+        for (uint8_t i=0; i < channels; i++) {
+            sensor->values[i] = values[i];
+        }
+    }
+
+    this->frame(record, length);
+}
+
+/**
+ * Make the next record from every sensor a key record. Useful 
+ * when a receiver has just connected. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void TelemetryEncoder::key() {
+    for (uint8_t i=0; i < TELEMETRY_SENSORS; i++) {
+        this->_sensors[i].untilKey = 0;
+    }
+}
+
+// COBS encode the record and write it with its delimiter in one go.
+void TelemetryEncoder::frame(const uint8_t record[], uint8_t length) {
+    uint8_t frame[TELEMETRY_MAX_FRAME + 1];
+    uint8_t code = 0;
+    uint8_t out = 1;
+
+    for (uint8_t i=0; i < length; i++) {
+        if (record[i] == 0) {
+            frame[code] = out - code;
+            code = out++;
+        } else {
+            frame[out++] = record[i];
+        }
+    }
+    frame[code] = out - code;
+    frame[out++] = 0;
+
+    this->_out->write(frame, out);
+}
@@ -0,0 +1,46 @@
+// Packed binary telemetry encoder for the sensor drivers
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef TelemetryEncoder_h
+#define TelemetryEncoder_h
+
+#include "Arduino.h"
+#include "TelemetryFormat.h"
+
+// Number of sensors whose previous values are remembered for delta
+// encoding. Others are always sent as key records.
+#ifndef TELEMETRY_SENSORS
+#define TELEMETRY_SENSORS       (4)
+#endif
+// A sensor sends a key record at least this often so a decoder can join
+// the stream or recover from a lost frame.
+#ifndef TELEMETRY_KEY_INTERVAL
+#define TELEMETRY_KEY_INTERVAL  (32)
+#endif
+
+// See .cpp source for method documentation.
+class TelemetryEncoder {
+public:
+    TelemetryEncoder(Print& out);
+    void compass(unsigned long time, int x, int y, int z, uint8_t instance = 0);
+    void gyroscope(unsigned long time, int x, int y, int z, uint8_t instance = 0);
+    void ping(unsigned long time, long mm, uint8_t instance = 0);
+    void temperature(unsigned long time, int deciC, uint8_t instance = 0);
+    void record(uint8_t type, uint8_t instance, unsigned long time, const long values[]);
+    void key();
+private:
+    struct Sensor {
+        uint8_t tag;
+        uint8_t untilKey;
+        unsigned long time;
+        long values[TELEMETRY_MAX_CHANNELS];
+    };
+    Print* _out;
+    uint8_t _sequence;
+    Sensor _sensors[TELEMETRY_SENSORS];
+    void frame(const uint8_t record[], uint8_t length);
+};
+
+#endif
@@ -0,0 +1,67 @@
+// Packed binary telemetry stream shared by the device encoder and host decoder
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// A stream is a series of COBS encoded records, each followed by a 0x00
+// delimiter. A record is:
+//
+//   tag       bit 7 key record, bits 6-4 sensor instance, bits 3-0 type
+//   sequence  one byte, incremented per record so loss can be detected
+//   time      varint ms; absolute in a key record, otherwise the time
+//             since the previous record of the same sensor
+//   values    one zigzag varint per channel; for delta encoded types a
+//             non key record holds the change since the previous record
+//
+// This header has no Arduino dependency so the host decoder can share it.
+
+#ifndef TelemetryFormat_h
+#define TelemetryFormat_h
+
+#include <stdint.h>
+
+// Sensor types and the number of channels each carries.
+#define TELEMETRY_COMPASS       (1)     // raw X, Y, Z
+#define TELEMETRY_GYROSCOPE     (2)     // raw X, Y, Z
+#define TELEMETRY_PING          (3)     // range in mm
+#define TELEMETRY_TEMPERATURE   (4)     // tenths of a degree C
+
+#define TELEMETRY_KEY           (0x80)
+#define TELEMETRY_MAX_CHANNELS  (3)
+
+// Types whose values change slowly enough for delta encoding to pay off.
+// Gyroscope rates sit near zero and are sent as they are.
+#define TELEMETRY_DELTA_TYPES   ((1 << TELEMETRY_COMPASS) | (1 << TELEMETRY_PING) | (1 << TELEMETRY_TEMPERATURE))
+
+// Largest record: tag, sequence, 5 byte time and three 5 byte values.
+#define TELEMETRY_MAX_RECORD    (2 + 5 + TELEMETRY_MAX_CHANNELS * 5)
+// COBS adds one byte per 254 plus the leading code byte.
+#define TELEMETRY_MAX_FRAME     (TELEMETRY_MAX_RECORD + 2)
+
+static inline uint8_t telemetryChannels(uint8_t type) {
+    return type == TELEMETRY_COMPASS || type == TELEMETRY_GYROSCOPE ? 3 : 1;
+}
+
+static inline bool telemetryIsDelta(uint8_t type) {
+    return (TELEMETRY_DELTA_TYPES >> type) & 1;
+}
+
+static inline uint8_t telemetryPutVarint(uint8_t* out, uint32_t value) {
+    uint8_t length = 0;
+    while (value >= 0x80) {
+        out[length++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    out[length++] = value;
+    return length;
+}
+
+static inline uint32_t telemetryZigzag(int32_t value) {
+    return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+}
+
+static inline int32_t telemetryUnzigzag(uint32_t value) {
+    return (int32_t) (value >> 1) ^ -(int32_t) (value & 1);
+}
+
+#endif
@@ -0,0 +1,210 @@
+// Host side decoder for the packed binary telemetry stream
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "TelemetryDecoder.h"
+
+/**
+ * Constructor. Delta records are dropped until a key record has 
+ * been seen for their sensor. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+TelemetryDecoder::TelemetryDecoder() {
+    this->reset();
+}
+
+/**
+ * Feed one byte of the stream. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param data The next byte received.
+ * @param sample Filled in when a sample completes.
+ * @return true when sample holds a new sample.
+ */
+bool TelemetryDecoder::push(uint8_t data, TelemetrySample& sample) {
+    if (data != 0) {
+        if (this->_length < sizeof(this->_frame)) {
+            this->_frame[this->_length++] = data;
+        } else {
+            this->_overflow = true;
+        }
+        return false;
+    }
+
+    bool ok = false;
+    if (this->_overflow) {
+        this->_errors++;
+    } else if (this->_length > 0) {
+        ok = this->parse(sample);
+    }
+    this->_length = 0;
+    this->_overflow = false;
+    return ok;
+}
+
+/**
+ * Feed a block of the stream, calling handler for each sample.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param data The bytes received.
+ * @param length The number of bytes.
+ * @param handler Called with each decoded sample.
+ * @param ctx Passed through to handler.
+ * @return The number of samples decoded.
+ */
+size_t TelemetryDecoder::decode(const uint8_t data[], size_t length, void (*handler)(const TelemetrySample&, void*), void* ctx) {
+    TelemetrySample sample;
+    size_t count = 0;
+
+    for (size_t i=0; i < length; i++) {
+        if (this->push(data[i], sample)) {
+            handler(sample, ctx);
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * Forget all sensor state and counters.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void TelemetryDecoder::reset() {
+    this->_length = 0;
+    this->_overflow = false;
+    this->_synced = false;
+    for (int i=0; i < TELEMETRY_DECODER_SENSORS; i++) {
+        this->_sensors[i].valid = false;
+    }
+    this->_samples = 0;
+    this->_errors = 0;
+    this->_lost = 0;
+}
+
+/**
+ * Gets the number of samples decoded.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The sample count.
+ */
+unsigned long TelemetryDecoder::samples() const {
+    return this->_samples;
+}
+
+/**
+ * Gets the number of frames that could not be decoded, 
+ * including delta records dropped while waiting for a key. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The error count.
+ */
+unsigned long TelemetryDecoder::errors() const {
+    return this->_errors;
+}
+
+/**
+ * Gets the number of records missing from the stream, going by 
+ * the sequence numbers. 
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ * @return The lost record count.
+ */
+unsigned long TelemetryDecoder::lost() const {
+    return this->_lost;
+}
+
+bool TelemetryDecoder::parse(TelemetrySample& sample) {
+    uint8_t record[TELEMETRY_MAX_FRAME];
+    size_t length = 0;
+
+    // Undo the COBS encoding.
+    size_t i = 0;
+    while (i < this->_length) {
+        uint8_t code = this->_frame[i++];
+        for (uint8_t j=1; j < code; j++) {
+            if (i >= this->_length) {
+                this->_errors++;
+                return false;
+            }
+            record[length++] = this->_frame[i++];
+        }
+        if (code < 0xFF && i < this->_length) {
+            record[length++] = 0;
+        }
+    }
+    if (length < 3) {
+        this->_errors++;
+        return false;
+    }
+
+    uint8_t tag = record[0];
+    uint8_t sequence = record[1];
+    bool isKey = tag & TELEMETRY_KEY;
+    sample.type = tag & 0x0F;
+    sample.instance = (tag >> 4) & 0x07;
+    sample.channels = telemetryChannels(sample.type);
+
+    if (sample.type < TELEMETRY_COMPASS || sample.type > TELEMETRY_TEMPERATURE) {
+        this->_errors++;
+        return false;
+    }
+
+    // A gap means a delta may have been lost, so every sensor must wait
+    // for its next key record.
+    if (this->_synced && sequence != (uint8_t) (this->_sequence + 1)) {
+        this->_lost += (uint8_t) (sequence - this->_sequence - 1);
+        for (int s=0; s < TELEMETRY_DECODER_SENSORS; s++) {
+            this->_sensors[s].valid = false;
+        }
+    }
+    this->_synced = true;
+    this->_sequence = sequence;
+
+    uint32_t fields[1 + TELEMETRY_MAX_CHANNELS];
+    uint8_t count = 0;
+    size_t pos = 2;
+    while (count < 1 + sample.channels) {
+        uint32_t value = 0;
+        uint8_t shift = 0;
+        uint8_t data;
+        do {
+            if (pos >= length || shift > 28) {
+                this->_errors++;
+                return false;
+            }
+            data = record[pos++];
+            value |= (uint32_t) (data & 0x7F) << shift;
+            shift += 7;
+        } while (data & 0x80);
+        fields[count++] = value;
+    }
+
+    Sensor& sensor = this->_sensors[(sample.type - 1) * 8 + sample.instance];
+    if (!isKey && !sensor.valid) {
+        this->_errors++;
+        return false;
+    }
+
+    bool isDelta = !isKey && telemetryIsDelta(sample.type);
+    sample.time = isKey ? fields[0] : sensor.time + fields[0];
+    for (uint8_t c=0; c < sample.channels; c++) {
+        int32_t value = telemetryUnzigzag(fields[1 + c]);
+        sample.values[c] = isDelta ? sensor.values[c] + value : value;
+        sensor.values[c] = sample.values[c];
+    }
+    sensor.time = sample.time;
+    sensor.valid = true;
+
+    this->_samples++;
+    return true;
+}
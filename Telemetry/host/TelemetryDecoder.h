@@ -0,0 +1,56 @@
+// Host side decoder for the packed binary telemetry stream
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// Plain C++ with no Arduino dependency. Build it alongside your host
+// tool with ../TelemetryFormat.h on the include path.
+
+#ifndef TelemetryDecoder_h
+#define TelemetryDecoder_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include "TelemetryFormat.h"
+
+// Sensors tracked at once, 8 instances of each of the 4 types.
+#define TELEMETRY_DECODER_SENSORS (32)
+
+// One decoded sample.
+struct TelemetrySample {
+    uint8_t type;
+    uint8_t instance;
+    uint8_t channels;
+    uint32_t time;
+    int32_t values[TELEMETRY_MAX_CHANNELS];
+};
+
+// See .cpp source for method documentation.
+class TelemetryDecoder {
+public:
+    TelemetryDecoder();
+    bool push(uint8_t data, TelemetrySample& sample);
+    size_t decode(const uint8_t data[], size_t length, void (*handler)(const TelemetrySample&, void*), void* ctx);
+    void reset();
+    unsigned long samples() const;
+    unsigned long errors() const;
+    unsigned long lost() const;
+private:
+    struct Sensor {
+        bool valid;
+        uint32_t time;
+        int32_t values[TELEMETRY_MAX_CHANNELS];
+    };
+    uint8_t _frame[TELEMETRY_MAX_FRAME];
+    size_t _length;
+    bool _overflow;
+    bool _synced;
+    uint8_t _sequence;
+    Sensor _sensors[TELEMETRY_DECODER_SENSORS];
+    unsigned long _samples;
+    unsigned long _errors;
+    unsigned long _lost;
+    bool parse(TelemetrySample& sample);
+};
+
+#endif
@@ -0,0 +1,201 @@
+// Cooperative tick scheduler for running the sensor and display drivers
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#include "Arduino.h"
+#include "TickScheduler.h"
+
+/**
+ * Constructor. Starts with no tasks.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+TickScheduler::TickScheduler() {
+    this->_count = 0;
+}
+
+/**
+ * Add a periodic task, reusing the slot of a removed one if 
+ * there is one. The first release is one period from now. A 
+ * run that finishes more than deadline after its release is 
+ * counted as an overrun. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param run The function to run each period.
+ * @param ctx Passed to run and poll, usually the driver.
+ * @param period Time between releases in microseconds, at 
+ *               least 1.
+ * @param deadline Time after release by which the run must 
+ *                 have finished, in microseconds.
+ * @param poll Optional readiness check. A released task is only 
+ *             run once this returns true.
+ * @return The task number, or TICK_NO_TASK if the table is 
+ *         full or the period is zero.
+ */
+int8_t TickScheduler::add(TickTaskFn run, void* ctx, unsigned long period, unsigned long deadline, TickPollFn poll) {
+    if (period == 0) {
+        return TICK_NO_TASK;
+    }
+
+    uint8_t slot = 0;
+    while (slot < this->_count && this->_tasks[slot].run != 0) {
+        slot++;
+    }
+    if (slot >= TICK_MAX_TASKS) {
+        return TICK_NO_TASK;
+    }
+
+    Task& task = this->_tasks[slot];
+    task.run = run;
+    task.poll = poll;
+    task.ctx = ctx;
+    task.period = period;
+    task.deadline = deadline;
+    task.release = micros() + period;
+    task.enabled = true;
+    memset(&task.stats, 0, sizeof(TickStats));
+
+    if (slot == this->_count) {
+        this->_count++;
+    }
+    return slot;
+}
+
+/**
+ * Remove a task. Its slot is free for the next add(); task 
+ * numbers of the remaining tasks do not change. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param task The task number returned by add().
+ */
+void TickScheduler::remove(int8_t task) {
+    if (task < 0 || task >= this->_count) {
+        return;
+    }
+    this->_tasks[task].run = 0;
+    this->_tasks[task].enabled = false;
+    while (this->_count > 0 && this->_tasks[this->_count - 1].run == 0) {
+        this->_count--;
+    }
+}
+
+/**
+ * Pause or resume a task. A resumed task is next released one 
+ * period from now. Removed tasks stay removed. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param task The task number returned by add().
+ * @param enabled true to run the task.
+ */
+void TickScheduler::setEnabled(int8_t task, bool enabled) {
+    if (task < 0 || task >= this->_count || this->_tasks[task].run == 0) {
+        return;
+    }
+    if (enabled && !this->_tasks[task].enabled) {
+        this->_tasks[task].release = micros() + this->_tasks[task].period;
+    }
+    this->_tasks[task].enabled = enabled;
+}
+
+/**
+ * Run at most one task: of the released tasks that are ready, 
+ * the one with the earliest deadline. Call as often as possible 
+ * from loop(). Running a single task per call keeps the time 
+ * spent in any one call bounded by the longest task. 
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @return true if a task was run.
+ */
+bool TickScheduler::tick() {
+    unsigned long now = micros();
+    int8_t next = TICK_NO_TASK;
+    unsigned long slack = 0;
+
+    for (uint8_t i=0; i < this->_count; i++) {
+        Task& task = this->_tasks[i];
+        if (!task.enabled || (long) (now - task.release) < 0) {
+            continue;
+        }
+        if (task.poll != 0 && !task.poll(task.ctx)) {
+            continue;
+        }
+
+        // Time left before the deadline, negative once it has passed.
+        unsigned long left = task.release + task.deadline - now;
+        if (next == TICK_NO_TASK || (long) (left - slack) < 0) {
+            next = i;
+            slack = left;
+        }
+    }
+
+    if (next == TICK_NO_TASK) {
+        return false;
+    }
+
+    Task& task = this->_tasks[next];
+    unsigned long lateness = now - task.release;
+    task.run(task.ctx);
+    unsigned long end = micros();
+    unsigned long runtime = end - now;
+
+    task.stats.runs++;
+    bool overrun = end - task.release > task.deadline;
+    if (lateness > task.stats.maxLateness) {
+        task.stats.maxLateness = lateness;
+    }
+    if (runtime > task.stats.maxRuntime) {
+        task.stats.maxRuntime = runtime;
+    }
+
+    // Keep to the original grid, skipping releases that were missed
+    // entirely rather than running the task back to back to catch up.
+    task.release += task.period;
+    if ((long) (end - task.release) >= 0) {
+        task.release += ((end - task.release) / task.period + 1) * task.period;
+        overrun = true;
+    }
+
+    // A late run counts once however many releases it cost.
+    if (overrun) {
+        task.stats.overruns++;
+    }
+
+    return true;
+}
+
+/**
+ * Gets the statistics for a task.
+ *  
+ * @author nedwidek (2026/10/19)
+ *  
+ * @param task The task number returned by add().
+ * @return Runs, overruns (runs that finished late or skipped a
+ *         release), and the worst lateness and runtime seen. All
+ *         zero for a task number that is not in use.
+ */
+const TickStats& TickScheduler::stats(int8_t task) {
+    static const TickStats none = { 0, 0, 0, 0 };
+
+    if (task < 0 || task >= this->_count || this->_tasks[task].run == 0) {
+        return none;
+    }
+    return this->_tasks[task].stats;
+}
+
+/**
+ * Clear the statistics of every task.
+ *  
+ * @author nedwidek (2026/10/19)
+ * 
+ */
+void TickScheduler::resetStats() {
+    for (uint8_t i=0; i < this->_count; i++) {
+        memset(&this->_tasks[i].stats, 0, sizeof(TickStats));
+    }
+}
@@ -0,0 +1,58 @@
+// Cooperative tick scheduler for running the sensor and display drivers
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+
+#ifndef TickScheduler_h
+#define TickScheduler_h
+
+#include "Arduino.h"
+
+// Maximum number of tasks. Each costs 35 bytes of RAM on the AVR.
+#ifndef TICK_MAX_TASKS
+#define TICK_MAX_TASKS (8)
+#endif
+
+// Returned by add() when the task table is full.
+#define TICK_NO_TASK   (-1)
+
+// Runs the task. ctx is the pointer given to add(), usually the driver.
+typedef void (*TickTaskFn)(void* ctx);
+// Called every tick() while a task is released but not yet run. Returns
+// true when the task is ready, e.g. a conversion has finished.
+typedef bool (*TickPollFn)(void* ctx);
+
+// Per task timing and overrun statistics, all times in microseconds.
+struct TickStats {
+    unsigned long runs;
+    unsigned long overruns;
+    unsigned long maxLateness;
+    unsigned long maxRuntime;
+};
+
+// See .cpp source for method documentation.
+class TickScheduler {
+public:
+    TickScheduler();
+    int8_t add(TickTaskFn run, void* ctx, unsigned long period, unsigned long deadline, TickPollFn poll = 0);
+    void remove(int8_t task);
+    void setEnabled(int8_t task, bool enabled);
+    bool tick();
+    const TickStats& stats(int8_t task);
+    void resetStats();
+private:
+    struct Task {
+        TickTaskFn run;
+        TickPollFn poll;
+        void* ctx;
+        unsigned long period;
+        unsigned long deadline;
+        unsigned long release;
+        bool enabled;
+        TickStats stats;
+    };
+    Task _tasks[TICK_MAX_TASKS];
+    uint8_t _count;
+};
+
+#endif
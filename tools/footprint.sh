@@ -0,0 +1,97 @@
+#!/bin/sh
+# Flash and RAM footprint of each driver, plain and compile time configured
+# Author: Erik Nedwidek
+# Date: 2026/10/19
+# License: BSD
+#
+# Needs avr-gcc and an Arduino 1.0+ install for the core, Wire and
+# SoftwareSerial sources:
+#   ARDUINO_DIR=/usr/share/arduino tools/footprint.sh
+# MCU and F_CPU default to an Uno. Sizes are what each probe sketch in
+# tools/footprint/Probe.cpp adds over an empty sketch; RAM is static data
+# and .bss only, not stack.
+
+set -e
+
+ARDUINO_DIR=${ARDUINO_DIR:-/usr/share/arduino}
+MCU=${MCU:-atmega328p}
+F_CPU=${F_CPU:-16000000UL}
+VARIANT=${VARIANT:-standard}
+BUILD=${BUILD:-/tmp/footprint}
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+
+# Arduino 1.5+ keeps the AVR core one level deeper than 1.0.
+AVR=$ARDUINO_DIR/hardware/arduino/avr
+if [ ! -d "$AVR/cores/arduino" ]; then
+    AVR=$ARDUINO_DIR/hardware/arduino
+fi
+if [ ! -d "$AVR/cores/arduino" ]; then
+    echo "No Arduino core under $ARDUINO_DIR; set ARDUINO_DIR." >&2
+    exit 1
+fi
+
+# Libraries moved their sources into src/ in 1.5 as well.
+WIRE=$AVR/libraries/Wire/src
+[ -d "$WIRE" ] || WIRE=$AVR/libraries/Wire
+[ -d "$WIRE" ] || WIRE=$ARDUINO_DIR/libraries/Wire
+SOFTSERIAL=$AVR/libraries/SoftwareSerial/src
+[ -d "$SOFTSERIAL" ] || SOFTSERIAL=$AVR/libraries/SoftwareSerial
+[ -d "$SOFTSERIAL" ] || SOFTSERIAL=$ARDUINO_DIR/libraries/SoftwareSerial
+
+FLAGS="-mmcu=$MCU -DF_CPU=$F_CPU -DARDUINO=100 -Os -ffunction-sections -fdata-sections"
+INCLUDES="-I$AVR/cores/arduino -I$AVR/variants/$VARIANT -I$WIRE -I$WIRE/utility -I$SOFTSERIAL"
+for lib in "$ROOT"/*/; do
+    INCLUDES="$INCLUDES -I$lib"
+done
+
+# The core and the libraries the drivers use go in one archive, so the
+# linker only pulls in what a probe needs.
+mkdir -p "$BUILD/core"
+rm -f "$BUILD/core.a"
+for src in "$AVR"/cores/arduino/*.c "$AVR"/cores/arduino/*.cpp "$WIRE"/*.cpp "$WIRE"/utility/*.c "$SOFTSERIAL"/*.cpp; do
+    [ -f "$src" ] || continue
+    obj=$BUILD/core/$(basename "$src").o
+    case $src in
+        *.c) avr-gcc $FLAGS $INCLUDES -c "$src" -o "$obj" ;;
+        *) avr-g++ $FLAGS -fno-exceptions -fpermissive $INCLUDES -c "$src" -o "$obj" ;;
+    esac
+    avr-ar rcs "$BUILD/core.a" "$obj"
+done
+
+# Prints "flash ram" for a probe, linking the driver's own sources.
+size() {
+    probe=$1
+    shift
+    elf=$BUILD/$probe.elf
+    avr-g++ $FLAGS -fno-exceptions -fpermissive -Wl,--gc-sections $INCLUDES -DPROBE_$probe \
+        "$ROOT/tools/footprint/Probe.cpp" "$@" "$BUILD/core.a" -o "$elf"
+    avr-size "$elf" | awk 'NR == 2 { print $1 + $2, $2 + $3 }'
+}
+
+set -- $(size NONE)
+BASE_FLASH=$1
+BASE_RAM=$2
+
+printf "%-12s %-8s %8s %8s\n" driver variant flash ram
+report() {
+    name=$1
+    probe=$2
+    variant=$3
+    shift 3
+    set -- $(size "$probe" "$@")
+    printf "%-12s %-8s %8d %8d\n" "$name" "$variant" $(($1 - BASE_FLASH)) $(($2 - BASE_RAM))
+}
+
+report TMP36 TMP36 class "$ROOT/TMP36/TMP36.cpp"
+report TMP36 STATIC_TMP36 static
+report ParallaxPing PING class "$ROOT/ParallaxPing/ParallaxPing.cpp"
+report ParallaxPing STATIC_PING static
+report Gyroscope GYRO class "$ROOT/Gyroscope/Gyroscope.cpp"
+report Gyroscope STATIC_GYRO static
+report Compass COMPASS class "$ROOT/Compass/Compass.cpp"
+report Compass STATIC_COMPASS static
+report ParallaxLCD LCD class "$ROOT/ParallaxLCD/ParallaxLCD.cpp"
+report ParallaxLCD STATIC_LCD static
+report RS2760249 STRIP class "$ROOT/RS2760249/RS2760249.cpp"
+report RS2760249 STATIC_STRIP static "$ROOT/RS2760249/RS2760249.cpp"
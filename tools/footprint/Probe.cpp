@@ -0,0 +1,82 @@
+// Footprint probe sketch, one driver variant per build
+// Author: Erik Nedwidek
+// Date: 2026/10/19
+// License: BSD
+//
+// footprint.sh builds this once per PROBE_ define and once with none, so
+// the size difference is what the driver variant costs. Each instance is
+// global so its RAM shows in .bss rather than on the stack.
+
+#include "Arduino.h"
+
+#if defined(PROBE_TMP36)
+#include <TMP36.h>
+TMP36 probe(A0);
+static void use() { volatile int t = probe.temperatureDeciC(); (void) t; }
+
+#elif defined(PROBE_STATIC_TMP36)
+#include <StaticTMP36.h>
+static void use() { volatile int t = StaticTMP36<A0>::temperatureDeciC(); (void) t; }
+
+#elif defined(PROBE_PING)
+#include <ParallaxPing.h>
+ParallaxPing probe(7);
+static void use() { volatile long r = probe.rangeRaw(); (void) r; }
+
+#elif defined(PROBE_STATIC_PING)
+#include <StaticParallaxPing.h>
+static void use() { volatile long r = StaticParallaxPing<7>::rangeRaw(); (void) r; }
+
+#elif defined(PROBE_GYRO)
+#include <Wire.h>
+#include <Gyroscope.h>
+Gyroscope probe;
+static void use() { probe.read(); volatile int x = probe.x; (void) x; }
+
+#elif defined(PROBE_STATIC_GYRO)
+#include <Wire.h>
+#include <StaticGyroscope.h>
+static void use() { int x, y, z; StaticGyroscope<>::read(x, y, z); volatile int v = x + y + z; (void) v; }
+
+#elif defined(PROBE_COMPASS)
+#include <Wire.h>
+#include <Compass.h>
+Compass probe;
+static void use() { probe.read(); volatile int x = probe.rawX; (void) x; }
+
+#elif defined(PROBE_STATIC_COMPASS)
+#include <Wire.h>
+#include <StaticCompass.h>
+static void use() { int x, y, z; StaticCompass<>::read(x, y, z); volatile int v = x + y + z; (void) v; }
+
+#elif defined(PROBE_LCD)
+#include <SoftwareSerial.h>
+#include <ParallaxLCD.h>
+ParallaxLCD probe(3, 9600);
+static void use() { probe.print("Hello"); }
+
+#elif defined(PROBE_STATIC_LCD)
+#include <StaticParallaxLCD.h>
+static void use() { StaticParallaxLCD<3>::print("Hello"); }
+
+#elif defined(PROBE_STRIP)
+#include <RS2760249.h>
+RS2760249 probe(2);
+static unsigned long pattern[1] = { 0x0000FF };
+static void use() { probe.sendPattern(pattern, 1); }
+
+#elif defined(PROBE_STATIC_STRIP)
+#include <StaticRS2760249.h>
+static unsigned long pattern[1] = { 0x0000FF };
+static void use() { StaticRS2760249<A2>::sendPattern(pattern, 1); }
+
+#else
+static void use() { }
+#endif
+
+void setup() {
+}
+
+void loop() {
+    use();
+}